@@ -0,0 +1,285 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "cached_polar.h" - Polar vectors that cache the sines and cosines of their                      *
+*                    angles, so that components can be found and fixed rotations                  *
+*                    applied without calls to trigonometric functions.                            *
+*                                                                                                 *
+*           Author - Tom McDonnell 2026                                                           *
+*                                                                                                 *
+\*************************************************************************************************/
+
+#ifndef TOMS_LIB_CACHED_POLAR_H
+#define TOMS_LIB_CACHED_POLAR_H
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "vector.h"
+#include "misc.h"
+
+#include <math.h>
+
+#include <cstddef>
+
+// GLOBAL TYPE DEFINITIONS ////////////////////////////////////////////////////////////////////////
+
+namespace TomsLibVector
+{
+ using namespace TomsLibMisc;
+
+ /*
+  * Rotation by a fixed angle, with its cosine and sine.
+  * Construct once and apply to many vectors.
+  */
+ class rotation
+ {
+  public:
+    explicit rotation(double a = 0): angle(a), c(cos(a)), s(sin(a)) {}
+
+    double getAngle(void) const {return angle;}
+    double getCos(void)   const {return     c;}
+    double getSin(void)   const {return     s;}
+
+  private:
+    double angle, c, s;
+ };
+
+ /*
+  * As pol2vector, but also storing cos(angle) and sin(angle).
+  *
+  * rotate() multiplies (cos(angle), sin(angle)) by (cos(a), sin(a)) as complex numbers instead
+  * of calling cos() and sin().  Rounding errors accumulate slowly in the cached values, so
+  * every 'resyncPeriod' rotations they are recalculated from the angle.
+  */
+ class cachedPol2vector
+ {
+  public:
+    static const int resyncPeriod = 1024;
+
+    cachedPol2vector(void): r(0), angle(0), c(1), s(0), rotations(0) {}
+    cachedPol2vector(double r1, double a1): rotations(0) {setR(r1); setAngle(a1);}
+
+    explicit cachedPol2vector(const pol2vector &v): rotations(0)
+    {
+       setR(v.getR()); setAngle(v.getAngle());
+    }
+
+    void setR(double r1)
+    {
+       if (0 <= r1)
+         r = r1;
+       else
+         error("Attempted to set cachedPol2vector.r to -tve value.");
+    }
+
+    void setAngle(double a)
+    {
+       if (-pi <= a && a <= pi)
+       {
+          angle = a;
+          c     = cos(a);
+          s     = sin(a);
+       }
+       else
+         error("Attempted to set cachedPol2vector.angle to value outside range [-pi, pi].");
+    }
+
+    double getR(void)     const {return     r;}
+    double getAngle(void) const {return angle;}
+    double getCos(void)   const {return     c;} // cos(angle)
+    double getSin(void)   const {return     s;} // sin(angle)
+
+    pol2vector toPol2vector(void) const {return pol2vector(r, angle);}
+
+    void rotate(double a) {rotate(rotation(a));}
+
+    void rotate(const rotation &rot)
+    {
+       double c1 = c * rot.getCos() - s * rot.getSin();
+
+       s      = s * rot.getCos() + c * rot.getSin();
+       c      = c1;
+       angle += rot.getAngle();
+
+       if (angle >  pi) angle -= twoPi;
+       if (angle < -pi) angle += twoPi;
+
+       if (++rotations == resyncPeriod)
+         resync();
+    }
+
+  private:
+    void resync(void) {c = cos(angle); s = sin(angle); rotations = 0;}
+
+    double r,     // r     must always be positive
+           angle, // angle must always be within range [-pi, pi]
+           c, s;  // cos(angle), sin(angle)
+    int    rotations; // rotations since c and s were last calculated from angle
+ };
+
+ /*
+  * As pol3vector, but also storing the cosines and sines of aXZ and aY.
+  * Rotations are applied as for cachedPol2vector.
+  */
+ class cachedPol3vector
+ {
+  public:
+    static const int resyncPeriod = 1024;
+
+    cachedPol3vector(void): r(0), aXZ(0), aY(0), cXZ(1), sXZ(0), cY(1), sY(0), rotations(0) {}
+
+    cachedPol3vector(double r1, double aXZ1, double aY1): rotations(0)
+    {
+       setR(r1); setAXZ(aXZ1); setAY(aY1);
+    }
+
+    explicit cachedPol3vector(const pol3vector &v): rotations(0)
+    {
+       setR(v.getR()); setAXZ(v.getAXZ()); setAY(v.getAY());
+    }
+
+    void setR(double r1)
+    {
+       if (0 <= r1)
+         r = r1;
+       else
+         error("Attempted to set cachedPol3vector.r to -tve value.");
+    }
+
+    void setAXZ(double aXZ1)
+    {
+       if (-pi <= aXZ1 && aXZ1 <= pi)
+       {
+          aXZ = aXZ1;
+          cXZ = cos(aXZ1);
+          sXZ = sin(aXZ1);
+       }
+       else
+         error("Attempted to set cachedPol3vector.aXZ to value outside range [-pi, pi].");
+    }
+
+    void setAY(double aY1)
+    {
+       if (-pi <= aY1 && aY1 <= pi)
+       {
+          aY = aY1;
+          cY = cos(aY1);
+          sY = sin(aY1);
+       }
+       else
+         error("Attempted to set cachedPol3vector.aY to value outside range [-pi, pi].");
+    }
+
+    double getR(void)     const {return   r;}
+    double getAXZ(void)   const {return aXZ;}
+    double getAY(void)    const {return  aY;}
+    double getCosXZ(void) const {return cXZ;} // cos(aXZ)
+    double getSinXZ(void) const {return sXZ;} // sin(aXZ)
+    double getCosY(void)  const {return  cY;} // cos(aY)
+    double getSinY(void)  const {return  sY;} // sin(aY)
+
+    pol3vector toPol3vector(void) const {return pol3vector(r, aXZ, aY);}
+
+    /*
+     * Rotate about the y axis (aXZ += rot.getAngle()).
+     */
+    void rotateXZ(const rotation &rot)
+    {
+       rotatePair(cXZ, sXZ, aXZ, rot);
+    }
+
+    /*
+     * Rotate away from the y axis (aY += rot.getAngle()).
+     */
+    void rotateY(const rotation &rot)
+    {
+       rotatePair(cY, sY, aY, rot);
+    }
+
+    void rotateXZ(double a) {rotateXZ(rotation(a));}
+    void rotateY(double a)  {rotateY(rotation(a)); }
+
+  private:
+    void rotatePair(double &c, double &s, double &a, const rotation &rot)
+    {
+       double c1 = c * rot.getCos() - s * rot.getSin();
+
+       s  = s * rot.getCos() + c * rot.getSin();
+       c  = c1;
+       a += rot.getAngle();
+
+       if (a >  pi) a -= twoPi;
+       if (a < -pi) a += twoPi;
+
+       if (++rotations == resyncPeriod)
+         resync();
+    }
+
+    void resync(void)
+    {
+       cXZ = cos(aXZ); sXZ = sin(aXZ);
+       cY  = cos(aY);  sY  = sin(aY);
+
+       rotations = 0;
+    }
+
+    double r,          // r   must always be positive
+           aXZ,        // aXZ must always be within range [-pi, pi]
+           aY,         // aY  must always be within range [-pi, pi]
+           cXZ, sXZ,   // cos(aXZ), sin(aXZ)
+           cY,  sY;    // cos(aY),  sin(aY)
+    int    rotations;  // rotations since the cached values were last calculated
+ };
+
+} // end namespace TomsLibVector
+
+// GLOBAL INLINE FUNCTION DEFINITIONS /////////////////////////////////////////////////////////////
+
+namespace TomsLibVector
+{
+
+ // cachedPol2vector functions
+
+ inline double xComponent(const cachedPol2vector &v) {return v.getR() * v.getCos();}
+ inline double yComponent(const cachedPol2vector &v) {return v.getR() * v.getSin();}
+
+ inline rec2vector convToRec(const cachedPol2vector &v)
+ {
+    return rec2vector(xComponent(v), yComponent(v));
+ }
+
+ /*
+  * Rotate each of the n vectors at v by the same rotation.
+  */
+ inline void rotate(cachedPol2vector *v, std::size_t n, const rotation &rot)
+ {
+    for (std::size_t i = 0; i < n; ++i)
+      v[i].rotate(rot);
+ }
+
+ // cachedPol3vector functions
+
+ inline double xComponent(const cachedPol3vector &v)
+ {
+    return v.getCosXZ() * (v.getR() * v.getSinY());
+ }
+
+ inline double yComponent(const cachedPol3vector &v)
+ {
+    return v.getR() * v.getCosY();
+ }
+
+ inline double zComponent(const cachedPol3vector &v)
+ {
+    return v.getSinXZ() * (v.getR() * v.getSinY());
+ }
+
+ inline rec3vector convToRec(const cachedPol3vector &v)
+ {
+    return rec3vector(xComponent(v), yComponent(v), zComponent(v));
+ }
+
+} // end namespace TomsLibVector
+
+#endif
+
+/*****************************************END*OF*FILE*********************************************/
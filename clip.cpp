@@ -0,0 +1,218 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "clip.cpp" -                                                                                    *
+*                                                                                                 *
+*     Author - Tom McDonnell 2026                                                                 *
+*                                                                                                 *
+\*************************************************************************************************/
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "clip.h"
+#include "simd.h"
+
+#include <algorithm>
+#include <limits>
+
+#include <cassert>
+
+// LOCAL FUNCTION DEFINITIONS /////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+ using TomsLibSimd::packd;
+ using TomsLibSimd::broadcast;
+ using TomsLibSimd::loadPartial;
+ using TomsLibSimd::storePartial;
+
+ /*
+  * Apply the constraint p * t <= q of one edge to the parameter range [t0, t1] of a pack of
+  * segments.  Lanes with p = 0 are parallel to the edge, and are rejected if outside it.
+  * Their quotients (infinite or NaN) are never selected.
+  */
+ static void clipEdge(packd p, packd q, packd &t0, packd &t1, packd &reject)
+ {
+    packd zero = broadcast(0.0),
+          t    = q / p;
+
+    reject = reject | (cmpeq(p, zero) & cmplt(q, zero));
+    t0     = select(cmplt(p, zero), max(t0, t), t0);
+    t1     = select(cmpgt(p, zero), min(t1, t), t1);
+ }
+
+ // Sutherland-Hodgman passes //
+
+ enum rectEdge {leftEdge, rightEdge, bottomEdge, topEdge};
+
+ template<rectEdge E>
+ static bool insideEdge(rec2vector p, const rect &r)
+ {
+    switch (E)
+    {
+     case leftEdge:   return p.x >= r.l;
+     case rightEdge:  return p.x <= r.r;
+     case bottomEdge: return p.y >= r.b;
+     default:         return p.y <= r.t;
+    }
+ }
+
+ /*
+  * Return the point where the segment from p (inside edge E) to q (outside) crosses the edge.
+  * Working from the inside point gives the same point for an edge shared by two polygons.
+  */
+ template<rectEdge E>
+ static rec2vector edgeCrossing(rec2vector p, rec2vector q, const rect &r)
+ {
+    if (E == leftEdge || E == rightEdge)
+    {
+       double x = (E == leftEdge)? r.l: r.r;
+
+       return rec2vector(x, p.y + (q.y - p.y) * ((x - p.x) / (q.x - p.x)));
+    }
+    else
+    {
+       double y = (E == bottomEdge)? r.b: r.t;
+
+       return rec2vector(p.x + (q.x - p.x) * ((y - p.y) / (q.y - p.y)), y);
+    }
+ }
+
+ /*
+  * Append to 'out' the n vertex polygon at v clipped to the inside of edge E of r.
+  */
+ template<rectEdge E>
+ static void clipToEdge(const rec2vector *v, std::size_t n, const rect &r,
+                        std::vector<rec2vector> &out                      )
+ {
+    if (n == 0) return;
+
+    rec2vector prev   = v[n - 1];
+    bool       prevIn = insideEdge<E>(prev, r);
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+       rec2vector cur   = v[i];
+       bool       curIn = insideEdge<E>(cur, r);
+
+       if (curIn)
+       {
+          if (!prevIn) out.push_back(edgeCrossing<E>(cur, prev, r));
+          out.push_back(cur);
+       }
+       else
+         if (prevIn) out.push_back(edgeCrossing<E>(prev, cur, r));
+
+       prev   = cur;
+       prevIn = curIn;
+    }
+ }
+
+} // end namespace TomsLibGeometry
+
+// MEMBER FUNCTION DEFINITIONS ////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ /*
+  * Polygons entirely inside or outside r (by their bounds) are copied or dropped without
+  * the passes, which suits many small polygons against a large rect.
+  */
+ std::size_t polygonClipper::clip(const polygonBatch &in, const rect &r, polygonBatch &out)
+ {
+    std::size_t count = 0;
+
+    out.clear();
+
+    for (std::size_t i = 0; i < in.size(); ++i)
+    {
+       const rec2vector *v = in[i];
+       std::size_t       n = in.size(i), start = out.vertices.size();
+
+       if (n >= 3)
+       {
+          rect bounds = {v[0].x, v[0].x, v[0].y, v[0].y};
+
+          for (std::size_t k = 1; k < n; ++k)
+          {
+             bounds.l = std::min(bounds.l, v[k].x); bounds.r = std::max(bounds.r, v[k].x);
+             bounds.b = std::min(bounds.b, v[k].y); bounds.t = std::max(bounds.t, v[k].y);
+          }
+
+          if (r.l <= bounds.l && bounds.r <= r.r && r.b <= bounds.b && bounds.t <= r.t)
+            out.vertices.insert(out.vertices.end(), v, v + n);
+          else if (bounds.l <= r.r && r.l <= bounds.r && bounds.b <= r.t && r.b <= bounds.t)
+          {
+             a.clear(); clipToEdge<leftEdge>(v, n, r, a);
+             b.clear(); clipToEdge<rightEdge>(a.data(), a.size(), r, b);
+             a.clear(); clipToEdge<bottomEdge>(b.data(), b.size(), r, a);
+             clipToEdge<topEdge>(a.data(), a.size(), r, out.vertices);
+
+             if (out.vertices.size() - start < 3) out.vertices.resize(start);
+          }
+       }
+
+       out.offset.push_back(out.vertices.size());
+
+       if (out.vertices.size() > start) ++count;
+    }
+
+    return count;
+ }
+
+} // end namespace TomsLibGeometry
+
+// GLOBAL FUNCTION DEFINITIONS ////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ std::size_t clipSegments(const rec2vectorBatch &p1, const rec2vectorBatch &p2, const rect &r,
+                          rec2vectorBatch &entry, rec2vectorBatch &exit,
+                          std::vector<unsigned char> &accepted                                )
+ {
+    std::size_t n = p1.size(), count = 0;
+    packd       l = broadcast(r.l), rr = broadcast(r.r),
+                b = broadcast(r.b), t  = broadcast(r.t),
+                nan = broadcast(std::numeric_limits<double>::quiet_NaN());
+
+    assert(p2.size() == n);
+
+    entry.resize(n);
+    exit.resize(n);
+    accepted.resize(n);
+
+    for (std::size_t i = 0; i < n; i += packd::width)
+    {
+       packd x1 = loadPartial(p1.x.data() + i, n - i), y1 = loadPartial(p1.y.data() + i, n - i),
+             x2 = loadPartial(p2.x.data() + i, n - i), y2 = loadPartial(p2.y.data() + i, n - i),
+             dx = x2 - x1, dy = y2 - y1,
+             t0 = broadcast(0.0), t1 = broadcast(1.0), reject = broadcast(0.0);
+
+       clipEdge(-dx, x1 - l,  t0, t1, reject);
+       clipEdge( dx, rr - x1, t0, t1, reject);
+       clipEdge(-dy, y1 - b,  t0, t1, reject);
+       clipEdge( dy, t - y1,  t0, t1, reject);
+
+       reject = reject | cmpgt(t0, t1);
+
+       storePartial(entry.x.data() + i, select(reject, nan, x1 + t0 * dx), n - i);
+       storePartial(entry.y.data() + i, select(reject, nan, y1 + t0 * dy), n - i);
+       storePartial(exit.x.data()  + i, select(reject, nan, x1 + t1 * dx), n - i);
+       storePartial(exit.y.data()  + i, select(reject, nan, y1 + t1 * dy), n - i);
+
+       int bits = ~movemask(reject);
+
+       for (int k = 0; k < packd::width && std::size_t(k) < n - i; ++k)
+       {
+          accepted[i + k] = (bits >> k) & 1;
+          count          += (bits >> k) & 1;
+       }
+    }
+
+    return count;
+ }
+
+} // end namespace TomsLibGeometry
+
+/*****************************************END*OF*FILE*********************************************/
@@ -0,0 +1,119 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "clip.h" - Clipping of line segments and polygons to rectangles.                                *
+*                                                                                                 *
+*   Author - Tom McDonnell 2026                                                                   *
+*                                                                                                 *
+\*************************************************************************************************/
+
+#ifndef TOMS_LIB_CLIP_H
+#define TOMS_LIB_CLIP_H
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "geometry.h"
+#include "polygon.h"
+#include "vector_batch.h"
+#include "vector.h"
+
+#include <vector>
+
+#include <cstddef>
+
+// GLOBAL TYPE DEFINITIONS ////////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ /*
+  * Clips batches of polygons to a rect by the Sutherland-Hodgman method.
+  *
+  * The clipper keeps the buffers used between the passes for the four edges, and the output
+  * batch is cleared and refilled, so clipping allocates nothing once the buffers and output
+  * have grown to their working sizes.
+  */
+ class polygonClipper
+ {
+  public:
+    /*
+     * Set 'out' to polygons 'in' clipped to rect r (closed, so points on its edges are
+     * inside), polygon i of 'out' being the part of polygon i of 'in' inside r.  Parts of
+     * fewer than three vertices are left empty.  Return the number of polygons not empty.
+     *
+     * A concave polygon whose part inside r is in pieces is clipped to a single polygon
+     * joining the pieces along the edges of r.
+     */
+    std::size_t clip(const polygonBatch &in, const rect &r, polygonBatch &out);
+
+  private:
+    std::vector<rec2vector> a, b;
+ };
+
+}
+
+// GLOBAL FUNCTION DECLARATIONS ///////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ /*
+  * Clip the segments p1[i] -> p2[i] to rect r (closed, so segments touching an edge are
+  * accepted), by the Liang-Barsky method.  For each i, accepted[i] is set to 1 and entry[i] and
+  * exit[i] to the ends of the part of the segment inside r, nearest p1[i] first, or if no
+  * part is inside, accepted[i] is set to 0 and entry[i] and exit[i] to NaN.
+  * Return the number of segments accepted.
+  *
+  * p1 and p2 must be the same size.  Outputs are resized to match if necessary, so nothing is
+  * allocated when they are reused for inputs of the same size.
+  */
+ std::size_t clipSegments(const rec2vectorBatch &p1, const rec2vectorBatch &p2, const rect &r,
+                          rec2vectorBatch &entry, rec2vectorBatch &exit,
+                          std::vector<unsigned char> &accepted                                );
+
+}
+
+// GLOBAL INLINE FUNCTION DEFINITIONS /////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ /*
+  * Clip the segment p1 -> p2 to rect r, replacing p1 and p2 with the ends of the part inside r.
+  * Return false (leaving p1 and p2 unchanged) if no part is inside.
+  */
+ inline bool clipSegment(rec2vector &p1, rec2vector &p2, const rect &r)
+ {
+    double dx = p2.x - p1.x, dy = p2.y - p1.y, t0 = 0, t1 = 1;
+
+    // p[k] * t <= q[k] for each edge (left, right, bottom, top) for points inside
+    double p[4] = {-dx, dx, -dy, dy},
+           q[4] = {p1.x - r.l, r.r - p1.x, p1.y - r.b, r.t - p1.y};
+
+    for (int k = 0; k < 4; ++k)
+    {
+       if (p[k] == 0)
+       {
+          if (q[k] < 0) return false; // parallel to and outside edge k
+       }
+       else
+       {
+          double t = q[k] / p[k];
+
+          if (p[k] < 0) {if (t > t0) t0 = t;}
+          else          {if (t < t1) t1 = t;}
+       }
+    }
+
+    if (t0 > t1) return false;
+
+    p2 = rec2vector(p1.x + t1 * dx, p1.y + t1 * dy);
+    p1 = rec2vector(p1.x + t0 * dx, p1.y + t0 * dy);
+
+    return true;
+ }
+
+} // end namespace TomsLibGeometry
+
+#endif
+
+/*****************************************END*OF*FILE*********************************************/
@@ -0,0 +1,297 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "curve_order.cpp" -                                                                             *
+*                                                                                                 *
+*            Author - Tom McDonnell 2026                                                          *
+*                                                                                                 *
+\*************************************************************************************************/
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "curve_order.h"
+#include "reduce.h"
+
+#include <algorithm>
+
+// LOCAL FUNCTION DEFINITIONS /////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+ using TomsLibParallel::padded;
+ using TomsLibParallel::parallelFor;
+ using TomsLibParallel::threadCount;
+
+ /*
+  * Convert the coordinates of a cell of a 2^b grid in n dimensions to the 'transposed'
+  * form of its Hilbert index (Skilling, "Programming the Hilbert curve", 2004).
+  * Interleaving the bits of the result, X[0] most significant, gives the index.
+  */
+ template<int n>
+ static void axesToTranspose(std::uint32_t (&X)[n], int b)
+ {
+    const std::uint32_t m = std::uint32_t(1) << (b - 1);
+
+    // inverse undo
+    for (std::uint32_t q = m; q > 1; q >>= 1)
+    {
+       std::uint32_t p = q - 1;
+
+       // if bit q of X[i] is set invert the low bits of X[0], else exchange them with
+       // those of X[i] (without branches, the bits being as good as random)
+       for (int i = 0; i < n; ++i)
+       {
+          std::uint32_t set = 0 - std::uint32_t((X[i] & q) != 0),
+                        t   = (X[0] ^ X[i]) & p & ~set;
+
+          X[0] ^= (p & set) | t;
+          X[i] ^= t;
+       }
+    }
+
+    // Gray encode
+    for (int i = 1; i < n; ++i)
+      X[i] ^= X[i - 1];
+
+    std::uint32_t t = 0;
+
+    for (std::uint32_t q = m; q > 1; q >>= 1)
+      t ^= (q - 1) & (0 - std::uint32_t((X[n - 1] & q) != 0));
+
+    for (int i = 0; i < n; ++i)
+      X[i] ^= t;
+ }
+
+ /*
+  * Maps coordinates within given bounds to cells of a grid 2^bits cells wide on its
+  * longest axis.
+  */
+ class quantizer
+ {
+  public:
+    quantizer(const double *lo, const double *hi, int dims, int bits)
+    {
+       double extent = 0;
+
+       for (int d = 0; d < dims; ++d)
+       {
+          this->lo[d] = lo[d];
+          this->hi[d] = hi[d];
+          extent = std::max(extent, hi[d] - lo[d]);
+       }
+
+       maxCell = double((std::uint64_t(1) << bits) - 1);
+       scale   = (extent > 0)? maxCell / extent: 0;
+    }
+
+    std::uint32_t operator()(double c, int d) const
+    {
+       double q = (std::min(std::max(c, lo[d]), hi[d]) - lo[d]) * scale;
+
+       return std::uint32_t(std::min(q, maxCell));
+    }
+
+  private:
+    double lo[3], hi[3], scale, maxCell;
+ };
+
+ static std::uint64_t curveKey(std::uint32_t x, std::uint32_t y, curveKind curve)
+ {
+    return (curve == hilbertCurve)? hilbertKey(x, y): mortonKey(x, y);
+ }
+
+ static std::uint64_t curveKey(std::uint32_t x, std::uint32_t y, std::uint32_t z,
+                               curveKind curve                                   )
+ {
+    return (curve == hilbertCurve)? hilbertKey(x, y, z): mortonKey(x, y, z);
+ }
+
+ /*
+  * Set perm to the order of the n keys ascending (sorting the keys).
+  */
+ static void orderByKey(std::uint64_t *keys, std::size_t n, std::vector<std::size_t> &perm,
+                        unsigned threads                                                   )
+ {
+    perm.resize(n);
+
+    for (std::size_t i = 0; i < n; ++i)
+      perm[i] = i;
+
+    radixSort(keys, &perm[0], n, threads);
+ }
+
+} // end namespace TomsLibGeometry
+
+// GLOBAL FUNCTION DEFINITIONS ////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ std::uint64_t hilbertKey(std::uint32_t x, std::uint32_t y)
+ {
+    std::uint32_t X[2] = {x, y};
+
+    axesToTranspose(X, 32);
+
+    return mortonKey(X[1], X[0]);
+ }
+
+ std::uint64_t hilbertKey(std::uint32_t x, std::uint32_t y, std::uint32_t z)
+ {
+    std::uint32_t X[3] = {x & 0x1fffff, y & 0x1fffff, z & 0x1fffff};
+
+    axesToTranspose(X, 21);
+
+    return mortonKey(X[2], X[1], X[0]);
+ }
+
+ void curveKeys(const rec2vector *v, std::size_t n, const rect &bounds, curveKind curve,
+                std::uint64_t *keys, unsigned threads                                   )
+ {
+    const double lo[2] = {bounds.l, bounds.b};
+    const double hi[2] = {bounds.r, bounds.t};
+    quantizer    q(lo, hi, 2, 32);
+
+    parallelFor(n, threads, [&](std::size_t begin, std::size_t end, unsigned)
+    {
+       for (std::size_t i = begin; i < end; ++i)
+         keys[i] = curveKey(q(v[i].x, 0), q(v[i].y, 1), curve);
+    });
+ }
+
+ void curveKeys(const rec3vector *v, std::size_t n, const box &bounds, curveKind curve,
+                std::uint64_t *keys, unsigned threads                                  )
+ {
+    const double lo[3] = {bounds.l, bounds.b, bounds.n};
+    const double hi[3] = {bounds.r, bounds.t, bounds.f};
+    quantizer    q(lo, hi, 3, 21);
+
+    parallelFor(n, threads, [&](std::size_t begin, std::size_t end, unsigned)
+    {
+       for (std::size_t i = begin; i < end; ++i)
+         keys[i] = curveKey(q(v[i].x, 0), q(v[i].y, 1), q(v[i].z, 2), curve);
+    });
+ }
+
+ /*
+  * Each pass sorts on one 8 bit digit.  Threads count the digits of their own contiguous
+  * ranges, then scatter their ranges to offsets ordered by (digit, thread), which keeps
+  * the sort stable.
+  */
+ void radixSort(std::uint64_t *keys, std::size_t *index, std::size_t n, unsigned threads)
+ {
+    typedef std::size_t histogram[256];
+
+    if (n < 2) return;
+
+    const unsigned                      count = threadCount(n, threads);
+    std::vector<padded<histogram> >     hist(count);
+    std::vector<padded<std::uint64_t> > differ(count);
+    std::vector<std::uint64_t>          keys2(n);
+    std::vector<std::size_t>            index2(n);
+
+    // find which bits differ between keys, to skip passes on digits that are all equal
+    parallelFor(n, threads, [&](std::size_t begin, std::size_t end, unsigned t)
+    {
+       std::uint64_t bits = 0;
+
+       for (std::size_t i = begin; i < end; ++i)
+         bits |= keys[i] ^ keys[0];
+
+       differ[t].value = bits;
+    });
+
+    std::uint64_t bits = 0;
+
+    for (unsigned t = 0; t < count; ++t)
+      bits |= differ[t].value;
+
+    std::uint64_t *srcKeys  = keys,  *dstKeys  = &keys2[0];
+    std::size_t   *srcIndex = index, *dstIndex = &index2[0];
+
+    for (int shift = 0; shift < 64; shift += 8)
+    {
+       if (((bits >> shift) & 0xff) == 0) continue;
+
+       parallelFor(n, threads, [&](std::size_t begin, std::size_t end, unsigned t)
+       {
+          std::size_t *h = hist[t].value;
+
+          std::fill(h, h + 256, std::size_t(0));
+
+          for (std::size_t i = begin; i < end; ++i)
+            ++h[(srcKeys[i] >> shift) & 0xff];
+       });
+
+       std::size_t offset = 0;
+
+       for (int d = 0; d < 256; ++d)
+         for (unsigned t = 0; t < count; ++t)
+         {
+            std::size_t c = hist[t].value[d];
+            hist[t].value[d] = offset;
+            offset += c;
+         }
+
+       parallelFor(n, threads, [&](std::size_t begin, std::size_t end, unsigned t)
+       {
+          std::size_t *h = hist[t].value;
+
+          for (std::size_t i = begin; i < end; ++i)
+          {
+             std::size_t j = h[(srcKeys[i] >> shift) & 0xff]++;
+
+             dstKeys[j]  = srcKeys[i];
+             dstIndex[j] = srcIndex[i];
+          }
+       });
+
+       std::swap(srcKeys, dstKeys);
+       std::swap(srcIndex, dstIndex);
+    }
+
+    if (srcKeys != keys)
+    {
+       std::copy(srcKeys, srcKeys + n, keys);
+       std::copy(srcIndex, srcIndex + n, index);
+    }
+ }
+
+ void curveOrder(const rec2vector *v, std::size_t n, curveKind curve,
+                 std::vector<std::size_t> &perm, unsigned threads    )
+ {
+    std::vector<std::uint64_t> keys(n);
+
+    if (n == 0) {perm.clear(); return;}
+
+    curveKeys(v, n, boundingRect(v, n, threads), curve, &keys[0], threads);
+    orderByKey(&keys[0], n, perm, threads);
+ }
+
+ void curveOrder(const rec3vector *v, std::size_t n, curveKind curve,
+                 std::vector<std::size_t> &perm, unsigned threads    )
+ {
+    std::vector<std::uint64_t> keys(n);
+
+    if (n == 0) {perm.clear(); return;}
+
+    curveKeys(v, n, boundingBox(v, n, threads), curve, &keys[0], threads);
+    orderByKey(&keys[0], n, perm, threads);
+ }
+
+ void sortAlongCurve(rec2vector *v, std::size_t n, curveKind curve,
+                     std::vector<std::size_t> &perm, unsigned threads)
+ {
+    curveOrder(v, n, curve, perm, threads);
+    applyPermutation(perm, v, threads);
+ }
+
+ void sortAlongCurve(rec3vector *v, std::size_t n, curveKind curve,
+                     std::vector<std::size_t> &perm, unsigned threads)
+ {
+    curveOrder(v, n, curve, perm, threads);
+    applyPermutation(perm, v, threads);
+ }
+
+} // end namespace TomsLibGeometry
+
+/*****************************************END*OF*FILE*********************************************/
@@ -0,0 +1,163 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "curve_order.h" - Space-filling curve (Morton and Hilbert) keys, and reordering of              *
+*                   arrays of points into curve order, so that points near each other             *
+*                   in space are near each other in memory.                                       *
+*                                                                                                 *
+*          Author - Tom McDonnell 2026                                                            *
+*                                                                                                 *
+\*************************************************************************************************/
+
+#ifndef TOMS_LIB_CURVE_ORDER_H
+#define TOMS_LIB_CURVE_ORDER_H
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "geometry.h"
+#include "parallel.h"
+#include "vector.h"
+
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+#ifdef __BMI2__
+#include <immintrin.h>
+#endif
+
+// GLOBAL TYPE DEFINITIONS ////////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ /*
+  * Hilbert order has better locality (consecutive cells are always adjacent), Morton
+  * order is cheaper to compute.
+  */
+ enum curveKind {mortonCurve, hilbertCurve};
+
+}
+
+// GLOBAL FUNCTION DECLARATIONS ///////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ // Keys along the curves of cells of an integer grid.  2D keys use all 32 bits of each
+ // coordinate, 3D keys use the low 21 bits of each coordinate (63 bits in all).
+
+ std::uint64_t hilbertKey(std::uint32_t x, std::uint32_t y);
+ std::uint64_t hilbertKey(std::uint32_t x, std::uint32_t y, std::uint32_t z);
+
+ /*
+  * keys[i] = key along 'curve' of v[i], with v[i] quantized to a grid over 'bounds'
+  * (the same number of cells per unit length on each axis).  Points outside 'bounds' are
+  * clamped to it.
+  */
+ void curveKeys(const rec2vector *v, std::size_t n, const rect &bounds, curveKind curve,
+                std::uint64_t *keys, unsigned threads = 0                               );
+ void curveKeys(const rec3vector *v, std::size_t n, const box &bounds, curveKind curve,
+                std::uint64_t *keys, unsigned threads = 0                              );
+
+ /*
+  * Sort the n keys into ascending order, applying the same permutation to 'index'.
+  * LSD radix sort, stable, skipping digits that are equal in all keys.
+  */
+ void radixSort(std::uint64_t *keys, std::size_t *index, std::size_t n, unsigned threads = 0);
+
+ /*
+  * Set perm so that v[perm[0]], v[perm[1]], ... v[perm[n - 1]] is in curve order
+  * (over the bounding rectangle/box of the n vectors).
+  */
+ void curveOrder(const rec2vector *v, std::size_t n, curveKind curve,
+                 std::vector<std::size_t> &perm, unsigned threads = 0);
+ void curveOrder(const rec3vector *v, std::size_t n, curveKind curve,
+                 std::vector<std::size_t> &perm, unsigned threads = 0);
+
+ /*
+  * Reorder the n vectors at v into curve order.  Arrays of data attached to the vectors
+  * can be reordered to match using applyPermutation(perm, ...).
+  */
+ void sortAlongCurve(rec2vector *v, std::size_t n, curveKind curve,
+                     std::vector<std::size_t> &perm, unsigned threads = 0);
+ void sortAlongCurve(rec3vector *v, std::size_t n, curveKind curve,
+                     std::vector<std::size_t> &perm, unsigned threads = 0);
+
+}
+
+// GLOBAL INLINE FUNCTION DEFINITIONS /////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ /*
+  * Spread the bits of x so that bit i moves to bit 2i (2D) or bit 3i (3D).
+  */
+ inline std::uint64_t spreadBits2(std::uint32_t x)
+ {
+#ifdef __BMI2__
+    return _pdep_u64(x, 0x5555555555555555ull);
+#else
+    std::uint64_t b = x;
+
+    b = (b | b << 16) & 0x0000ffff0000ffffull;
+    b = (b | b <<  8) & 0x00ff00ff00ff00ffull;
+    b = (b | b <<  4) & 0x0f0f0f0f0f0f0f0full;
+    b = (b | b <<  2) & 0x3333333333333333ull;
+    b = (b | b <<  1) & 0x5555555555555555ull;
+
+    return b;
+#endif
+ }
+
+ inline std::uint64_t spreadBits3(std::uint32_t x)
+ {
+#ifdef __BMI2__
+    return _pdep_u64(x, 0x1249249249249249ull);
+#else
+    std::uint64_t b = x & 0x1fffff;
+
+    b = (b | b << 32) & 0x001f00000000ffffull;
+    b = (b | b << 16) & 0x001f0000ff0000ffull;
+    b = (b | b <<  8) & 0x100f00f00f00f00full;
+    b = (b | b <<  4) & 0x10c30c30c30c30c3ull;
+    b = (b | b <<  2) & 0x1249249249249249ull;
+
+    return b;
+#endif
+ }
+
+ // bits of x lowest, then y, then z
+
+ inline std::uint64_t mortonKey(std::uint32_t x, std::uint32_t y)
+ {
+    return spreadBits2(x) | spreadBits2(y) << 1;
+ }
+
+ inline std::uint64_t mortonKey(std::uint32_t x, std::uint32_t y, std::uint32_t z)
+ {
+    return spreadBits3(x) | spreadBits3(y) << 1 | spreadBits3(z) << 2;
+ }
+
+ /*
+  * Reorder a[0 .. perm.size() - 1] so that new a[i] = old a[perm[i]].
+  */
+ template<class T>
+ inline void applyPermutation(const std::vector<std::size_t> &perm, T *a, unsigned threads = 0)
+ {
+    std::vector<T> copy(a, a + perm.size());
+
+    TomsLibParallel::parallelFor(perm.size(), threads,
+                                 [&](std::size_t begin, std::size_t end, unsigned)
+    {
+       for (std::size_t i = begin; i < end; ++i)
+         a[i] = copy[perm[i]];
+    });
+ }
+
+} // end namespace TomsLibGeometry
+
+#endif
+
+/*****************************************END*OF*FILE*********************************************/
@@ -0,0 +1,553 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "delaunay.cpp" -                                                                                *
+*                                                                                                 *
+*         Author - Tom McDonnell 2026                                                             *
+*                                                                                                 *
+\*************************************************************************************************/
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "delaunay.h"
+#include "curve_order.h"
+#include "parallel.h"
+#include "predicates.h"
+#include "reduce.h"
+
+#include <algorithm>
+
+#include <cassert>
+
+// LOCAL TYPE DEFINITIONS /////////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ /*
+  * Working state of delaunayTriangulation::build().  Vertices are indices into v, with
+  * vertex v.size() standing for the point at infinity shared by the ghost triangles.
+  *
+  * Inserting point p:
+  *  - walk from the last triangle made towards p, stepping across any edge that p is
+  *    strictly right of, until reaching a triangle containing p (or a ghost triangle, if p
+  *    is outside the hull),
+  *  - grow from there the cavity of triangles in conflict with p (those whose circumcircles
+  *    have p strictly inside, or for a ghost, those whose hull edge p is strictly outside of
+  *    or strictly within),
+  *  - replace the cavity with a fan of triangles joining p to its boundary, reusing the
+  *    slots of the cavity triangles (the fan always has two more).
+  */
+ class delaunayBuilder
+ {
+  public:
+    delaunayBuilder(const std::vector<rec2vector> &v);
+
+    /*
+     * Insert v[3], v[4], ... into the triangle v[0], v[1], v[2] (which must not be
+     * collinear).  Points that repeat an earlier point are left out.
+     */
+    void run(void);
+
+    /*
+     * Half-edges and their twins are kept with their triangle (two triangles to a cache
+     * line), as the walk and the cavity search visit both.
+     */
+    struct triangle
+    {
+       std::uint32_t vertex[3]; // vertex[k] = origin of half-edge 3t + k
+       std::uint32_t twin[3];
+       std::uint32_t stamp;     // = i if the triangle is in the cavity of point i
+       std::uint32_t unused;
+    };
+
+    std::uint32_t  vertex(std::uint32_t e) const {return tris[e / 3].vertex[e % 3];}
+    std::uint32_t &twin(std::uint32_t e)         {return tris[e / 3].twin[e % 3];}
+
+    std::vector<triangle> tris;
+
+  private:
+    struct boundaryEdge
+    {
+       std::uint32_t a, b, outside; // edge a -> b of the cavity, twin of 'outside'
+    };
+
+    bool isGhost(const triangle &t) const
+    {
+       return t.vertex[0] == ghost || t.vertex[1] == ghost || t.vertex[2] == ghost;
+    }
+
+    bool conflict(std::uint32_t t, rec2vector p) const;
+    void insert(std::uint32_t i);
+
+    const std::vector<rec2vector> &v;
+    const std::uint32_t            ghost;
+    std::uint32_t                  last;    // a non-ghost triangle to start walks from
+
+    std::vector<std::uint32_t>     fanAt;   // fanAt[a] = new triangle with edge from a
+    std::vector<std::uint32_t>     cavity;
+    std::vector<boundaryEdge>      boundary;
+ };
+
+}
+
+// LOCAL FUNCTION DEFINITIONS /////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+ using TomsLibParallel::parallelFor;
+
+ static std::uint32_t nextEdge(std::uint32_t e) {return delaunayTriangulation::next(e);}
+
+ /*
+  * Return true if p, on the line through a and b, is strictly between them.
+  */
+ static bool strictlyBetween(rec2vector a, rec2vector b, rec2vector p)
+ {
+    if (a.x != b.x)
+      return (a.x < b.x)? (a.x < p.x && p.x < b.x): (b.x < p.x && p.x < a.x);
+
+    return (a.y < b.y)? (a.y < p.y && p.y < b.y): (b.y < p.y && p.y < a.y);
+ }
+
+ /*
+  * Cut the convex polygon 'in' by the half-plane (x - m) . w <= 0, into 'out'.
+  */
+ static void cutByHalfPlane(const std::vector<rec2vector> &in, rec2vector m, rec2vector w,
+                            std::vector<rec2vector> &out                                  )
+ {
+    out.clear();
+
+    if (in.empty()) return;
+
+    rec2vector a  = in.back();
+    double     fa = (a.x - m.x) * w.x + (a.y - m.y) * w.y;
+
+    // cuts near a vertex can round onto it, so equal neighbours are merged
+    auto emit = [&](rec2vector v) {if (out.empty() || v != out.back()) out.push_back(v);};
+
+    for (std::size_t k = 0; k < in.size(); ++k)
+    {
+       rec2vector b  = in[k];
+       double     fb = (b.x - m.x) * w.x + (b.y - m.y) * w.y;
+
+       // a vertex on the line is kept as it is, not also emitted as a crossing
+       if ((fa < 0 && fb > 0) || (fa > 0 && fb < 0))
+         emit(a + (b - a) * (fa / (fa - fb)));
+
+       if (fb <= 0)
+         emit(b);
+
+       a  = b;
+       fa = fb;
+    }
+
+    if (out.size() > 1 && out.front() == out.back())
+      out.pop_back();
+ }
+
+ /*
+  * Set 'cell' to the Voronoi cell of point i clipped to 'bounds' (see voronoiCells()).
+  *
+  * If point i is inside the hull its cell is the polygon joining the circumcentres of the
+  * triangles about it, which needs no clipping if they are all within 'bounds'.  Otherwise
+  * 'bounds' is cut by the bisector between point i and each of its neighbours.
+  */
+ static void voronoiCell(const delaunayTriangulation &d, const rec2vector *points,
+                         std::size_t i, const rect &bounds, std::vector<rec2vector> &cell,
+                         std::vector<rec2vector> &cut                                     )
+ {
+    typedef delaunayTriangulation dt;
+
+    std::uint32_t start = (i < d.incident.size())? d.incident[i]: dt::none, e = start;
+    bool          inside = true;
+
+    cell.clear();
+
+    if (start == dt::none) return;
+
+    // turn anticlockwise about point i
+    do
+    {
+       std::uint32_t f = dt::prev(e);
+       rec2vector    c = circumcentre(points[d.origin[e]], points[d.origin[dt::next(e)]],
+                                      points[d.origin[f]]                               );
+
+       if (d.twin[f] == dt::none || !(bounds.l <= c.x && c.x <= bounds.r &&
+                                      bounds.b <= c.y && c.y <= bounds.t    ))
+       {
+          inside = false;
+          break;
+       }
+
+       // cocircular points give several triangles with the same circumcentre
+       if (cell.empty() || c != cell.back())
+         cell.push_back(c);
+
+       e = d.twin[f];
+    }
+    while (e != start);
+
+    if (inside)
+    {
+       if (cell.size() > 1 && cell.front() == cell.back())
+         cell.pop_back();
+
+       return;
+    }
+
+    rec2vector p = points[i];
+
+    cell.clear();
+    cell.push_back(rec2vector(bounds.l, bounds.b));
+    cell.push_back(rec2vector(bounds.r, bounds.b));
+    cell.push_back(rec2vector(bounds.r, bounds.t));
+    cell.push_back(rec2vector(bounds.l, bounds.t));
+
+    auto cutBy = [&](std::uint32_t q)
+    {
+       cutByHalfPlane(cell, (p + points[q]) * 0.5, points[q] - p, cut);
+       cell.swap(cut);
+    };
+
+    e = start;
+
+    do
+    {
+       cutBy(d.origin[dt::next(e)]);
+
+       std::uint32_t f = dt::prev(e);
+
+       if (d.twin[f] == dt::none)
+       {
+          cutBy(d.origin[f]);
+          break;
+       }
+
+       e = d.twin[f];
+    }
+    while (e != start && !cell.empty());
+ }
+
+} // end namespace TomsLibGeometry
+
+// STATIC MEMBER CONSTANT DEFINITIONS /////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ const std::uint32_t delaunayTriangulation::none;
+
+}
+
+// MEMBER FUNCTION DEFINITIONS ////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ /*
+  * Make the first triangle and the three ghost triangles outside its edges.
+  */
+ delaunayBuilder::delaunayBuilder(const std::vector<rec2vector> &v):
+   v(v), ghost(std::uint32_t(v.size())), last(0), fanAt(v.size() + 1)
+ {
+    std::uint32_t a = 0, b = 1, c = 2;
+
+    if (orient(v[a], v[b], v[c]) < 0) std::swap(b, c);
+
+    const triangle first[4] = {{{a, b, c},     {}, ghost, 0}, {{b, a, ghost}, {}, ghost, 0},
+                               {{c, b, ghost}, {}, ghost, 0}, {{a, c, ghost}, {}, ghost, 0}};
+
+    tris.reserve(2 * v.size() + 4);
+    tris.assign(first, first + 4);
+
+    // the twin of e is the half-edge from the end of e to its start
+    for (std::uint32_t e = 0; e < 12; ++e)
+      for (std::uint32_t f = 0; f < 12; ++f)
+        if (vertex(f) == vertex(nextEdge(e)) && vertex(nextEdge(f)) == vertex(e))
+          twin(e) = f;
+ }
+
+ void delaunayBuilder::run(void)
+ {
+    for (std::uint32_t i = 3; i < ghost; ++i)
+      insert(i);
+ }
+
+ bool delaunayBuilder::conflict(std::uint32_t t, rec2vector p) const
+ {
+    const std::uint32_t *w = tris[t].vertex;
+
+    if (w[0] != ghost && w[1] != ghost && w[2] != ghost)
+      return inCircle(v[w[0]], v[w[1]], v[w[2]], p) > 0;
+
+    // the hull edge of a ghost triangle is the one opposite the ghost vertex
+    int        k = (w[0] == ghost)? 1: (w[1] == ghost)? 2: 0;
+    rec2vector a = v[w[k]], b = v[w[(k + 1) % 3]];
+    double     o = orient(a, b, p);
+
+    return o > 0 || (o == 0 && strictlyBetween(a, b, p));
+ }
+
+ void delaunayBuilder::insert(std::uint32_t i)
+ {
+    rec2vector    p = v[i];
+    std::uint32_t t = last, from = delaunayTriangulation::none;
+
+    // walk to a triangle containing p (from = the edge crossed into t, known to be passed)
+    while (!isGhost(tris[t]))
+    {
+       const std::uint32_t *w = tris[t].vertex;
+       std::uint32_t        k = 0;
+
+       for (; k < 3; ++k)
+         if (3 * t + k != from && orient(v[w[k]], v[w[(k + 1) % 3]], p) < 0)
+           break;
+
+       if (k == 3)
+       {
+          if (v[w[0]] == p || v[w[1]] == p || v[w[2]] == p)
+            return;
+
+          break;
+       }
+
+       from = tris[t].twin[k];
+       t    = from / 3;
+    }
+
+    // grow the cavity
+    cavity.clear();
+    boundary.clear();
+
+    cavity.push_back(t);
+    tris[t].stamp = i;
+
+    for (std::size_t j = 0; j < cavity.size(); ++j)
+    {
+       const triangle &c = tris[cavity[j]];
+
+       for (int k = 0; k < 3; ++k)
+       {
+          std::uint32_t u = c.twin[k] / 3;
+
+          if (tris[u].stamp == i) continue;
+
+          if (conflict(u, p))
+          {
+             tris[u].stamp = i;
+             cavity.push_back(u);
+          }
+          else
+            boundary.push_back({c.vertex[k], c.vertex[(k + 1) % 3], c.twin[k]});
+       }
+    }
+
+    // fill it with a fan about p
+    std::size_t more = boundary.size() - cavity.size(), end = tris.size();
+
+    for (std::size_t j = 0; j < more; ++j)
+      cavity.push_back(std::uint32_t(end + j));
+
+    tris.resize(end + more);
+
+    for (std::size_t j = 0; j < boundary.size(); ++j)
+    {
+       const boundaryEdge &edge = boundary[j];
+       std::uint32_t       n    = cavity[j];
+       triangle           &f    = tris[n];
+
+       f.vertex[0] = edge.a; f.vertex[1] = edge.b; f.vertex[2] = i;
+       f.twin[0]   = edge.outside;
+       f.stamp     = i;
+
+       twin(edge.outside) = 3 * n;
+       fanAt[edge.a]      = n;
+
+       if (edge.a != ghost && edge.b != ghost)
+         last = n;
+    }
+
+    for (std::size_t j = 0; j < boundary.size(); ++j)
+    {
+       std::uint32_t n = cavity[j], m = fanAt[boundary[j].b];
+
+       tris[n].twin[1] = 3 * m + 2;
+       tris[m].twin[2] = 3 * n + 1;
+    }
+ }
+
+ /*
+  * The points are put in curve order, with the first three that are distinct and not
+  * collinear moved to the front to make the first triangle.  Ghost triangles are then
+  * dropped and the others renumbered in the order of their slots.
+  */
+ void delaunayTriangulation::build(const rec2vector *points, std::size_t n, unsigned threads)
+ {
+    assert(n < (std::size_t(1) << 29));
+
+    origin.clear();
+    twin.clear();
+    incident.assign(n, none);
+
+    if (n < 3) return;
+
+    // order along the Hilbert curve, with the keys cut to about 256 cells per point so that
+    // fewer digits are sorted
+    std::vector<std::uint64_t> keys(n);
+    std::vector<std::size_t>   perm(n);
+    int                        bits = 10;
+
+    while (bits < 64 && (std::uint64_t(1) << (bits - 8)) < n)
+      bits += 2;
+
+    curveKeys(points, n, boundingRect(points, n, threads), hilbertCurve, &keys[0], threads);
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+       keys[i] >>= 64 - bits;
+       perm[i]   = i;
+    }
+
+    radixSort(&keys[0], &perm[0], n, threads);
+
+    std::size_t b = 1, c;
+
+    while (b < n && points[perm[b]] == points[perm[0]])
+      ++b;
+
+    for (c = b + 1; c < n; ++c)
+      if (orient(points[perm[0]], points[perm[b]], points[perm[c]]) != 0)
+        break;
+
+    if (c >= n) return; // all collinear
+
+    std::swap(perm[1], perm[b]);
+    std::swap(perm[2], perm[c]);
+
+    std::vector<rec2vector> v(n);
+
+    parallelFor(n, threads, [&](std::size_t begin, std::size_t end, unsigned)
+    {
+       for (std::size_t i = begin; i < end; ++i)
+         v[i] = points[perm[i]];
+    });
+
+    delaunayBuilder builder(v);
+
+    builder.run();
+
+    // renumber the triangles, leaving out ghosts
+    const std::vector<delaunayBuilder::triangle> &tris = builder.tris;
+
+    std::size_t                triangles = tris.size();
+    std::vector<std::uint32_t> renumber(triangles, none);
+    std::uint32_t              count = 0;
+
+    for (std::size_t t = 0; t < triangles; ++t)
+    {
+       const std::uint32_t *w = tris[t].vertex;
+
+       if (w[0] != n && w[1] != n && w[2] != n)
+         renumber[t] = count++;
+    }
+
+    origin.resize(3 * std::size_t(count));
+    twin.resize(3 * std::size_t(count));
+
+    parallelFor(triangles, threads, [&](std::size_t begin, std::size_t end, unsigned)
+    {
+       for (std::size_t t = begin; t < end; ++t)
+       {
+          if (renumber[t] == none) continue;
+
+          for (std::size_t k = 0; k < 3; ++k)
+          {
+             std::uint32_t f = tris[t].twin[k], g = renumber[f / 3];
+
+             origin[3 * renumber[t] + k] = std::uint32_t(perm[tris[t].vertex[k]]);
+             twin[3 * renumber[t] + k]   = (g == none)? none: 3 * g + f % 3;
+          }
+       }
+    });
+
+    // find the incident edges in the order of v, where they are near each other
+    std::vector<std::uint32_t> from(n, none);
+
+    for (std::size_t t = 0; t < triangles; ++t)
+      if (renumber[t] != none)
+        for (std::uint32_t k = 0; k < 3; ++k)
+        {
+           std::uint32_t a = tris[t].vertex[k], e = 3 * renumber[t] + k;
+
+           if (from[a] == none || twin[e] == none)
+             from[a] = e;
+        }
+
+    parallelFor(n, threads, [&](std::size_t begin, std::size_t end, unsigned)
+    {
+       for (std::size_t i = begin; i < end; ++i)
+         incident[perm[i]] = from[i];
+    });
+ }
+
+} // end namespace TomsLibGeometry
+
+// GLOBAL FUNCTION DEFINITIONS ////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ rec2vector circumcentre(rec2vector a, rec2vector b, rec2vector c)
+ {
+    rec2vector ab = b - a, ac = c - a;
+    double     abSq = ab.x * ab.x + ab.y * ab.y,
+               acSq = ac.x * ac.x + ac.y * ac.y,
+               d    = 2 * (ab.x * ac.y - ab.y * ac.x);
+
+    return a + rec2vector((ac.y * abSq - ab.y * acSq) / d, (ab.x * acSq - ac.x * abSq) / d);
+ }
+
+ /*
+  * Each thread builds the cells of a contiguous range of points into a batch of its own, and
+  * the batches are then joined in order.
+  */
+ void voronoiCells(const delaunayTriangulation &d, const rec2vector *points, std::size_t n,
+                   const rect &bounds, polygonBatch &cells, unsigned threads               )
+ {
+    unsigned                  count = TomsLibParallel::threadCount(n, threads);
+    std::vector<polygonBatch> parts(count);
+
+    parallelFor(n, threads, [&](std::size_t begin, std::size_t end, unsigned t)
+    {
+       polygonBatch           &out = parts[t];
+       std::vector<rec2vector> cell, cut;
+
+       out.reserve(end - begin, 6 * (end - begin));
+
+       for (std::size_t i = begin; i < end; ++i)
+       {
+          voronoiCell(d, points, i, bounds, cell, cut);
+
+          out.append(cell.data(), cell.size());
+       }
+    });
+
+    if (count == 1) {std::swap(cells, parts[0]); return;}
+
+    cells.clear();
+
+    std::size_t vertices = 0;
+
+    for (unsigned t = 0; t < count; ++t)
+      vertices += parts[t].vertices.size();
+
+    cells.reserve(n, vertices);
+
+    for (unsigned t = 0; t < count; ++t)
+      for (std::size_t i = 0; i < parts[t].size(); ++i)
+        cells.append(parts[t][i], parts[t].size(i));
+ }
+
+} // end namespace TomsLibGeometry
+
+/*****************************************END*OF*FILE*********************************************/
@@ -0,0 +1,105 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "delaunay.h" - Delaunay triangulation of sets of points, stored as half-edges,                  *
+*                and the Voronoi cells of the points.                                             *
+*                                                                                                 *
+*       Author - Tom McDonnell 2026                                                               *
+*                                                                                                 *
+\*************************************************************************************************/
+
+#ifndef TOMS_LIB_DELAUNAY_H
+#define TOMS_LIB_DELAUNAY_H
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "geometry.h"
+#include "polygon.h"
+#include "vector.h"
+
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+// GLOBAL TYPE DEFINITIONS ////////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ /*
+  * Delaunay triangulation of a set of points, as half-edges.
+  *
+  * Triangle t is half-edges 3t, 3t + 1 and 3t + 2, in anticlockwise order.  origin[e] is the
+  * index of the point at the start of half-edge e, and twin[e] is the half-edge running the
+  * other way along the same edge (in the neighbouring triangle), or none if e is on the
+  * convex hull.  incident[i] is a half-edge starting at point i, or none if point i is not a
+  * vertex (because it repeats an earlier point, or because all the points are collinear, in
+  * which case there are no triangles).  For points on the hull, incident[i] is the hull edge
+  * starting at i, so that turning anticlockwise about i from incident[i] visits every edge
+  * from i before reaching the other side of the hull.
+  *
+  * The points are inserted one at a time (Bowyer-Watson), in Hilbert curve order so that each
+  * point is found by a short walk from the last.  Triangles outside the hull are kept during
+  * the build as 'ghost' triangles joining the hull edges to a vertex at infinity, so that
+  * points outside the hull need no special case.  Orientation and in-circle tests are exact
+  * (predicates.h), so the result is a valid Delaunay triangulation for any finite input.
+  * Where four or more points are cocircular, which of the valid triangulations is produced
+  * depends on the insertion order.
+  */
+ class delaunayTriangulation
+ {
+  public:
+    static const std::uint32_t none = 0xffffffff;
+
+    delaunayTriangulation(void) {}
+    delaunayTriangulation(const rec2vector *points, std::size_t n, unsigned threads = 0)
+    {
+       build(points, n, threads);
+    }
+
+    /*
+     * Triangulate the n points (n < 2^29).  'threads' threads are used for the ordering
+     * of the points (0 = one per core); the insertion itself is sequential.
+     */
+    void build(const rec2vector *points, std::size_t n, unsigned threads = 0);
+
+    std::size_t triangleCount(void) const {return origin.size() / 3;}
+
+    static std::uint32_t triangle(std::uint32_t e) {return e / 3;}
+    static std::uint32_t next(std::uint32_t e)     {return (e % 3 == 2)? e - 2: e + 1;}
+    static std::uint32_t prev(std::uint32_t e)     {return (e % 3 == 0)? e + 2: e - 1;}
+
+    std::vector<std::uint32_t> origin;
+    std::vector<std::uint32_t> twin;
+    std::vector<std::uint32_t> incident;
+ };
+
+}
+
+// GLOBAL FUNCTION DECLARATIONS ///////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ /*
+  * Return the centre of the circle through a, b and c (infinite or NaN if they are
+  * collinear).
+  */
+ rec2vector circumcentre(rec2vector a, rec2vector b, rec2vector c);
+
+ /*
+  * Set cells[i] to the Voronoi cell of points[i] clipped to 'bounds', as an anticlockwise
+  * convex polygon, where d is the Delaunay triangulation of the n points.  Cells of points
+  * that are not vertices of d, and cells wholly outside 'bounds', are empty.  Cells are
+  * joined from the circumcentres of the triangles of d where they can be, and otherwise
+  * (as for points on the hull, whose cells are unbounded) found by cutting 'bounds' with
+  * the bisectors between the point and its neighbours.
+  */
+ void voronoiCells(const delaunayTriangulation &d, const rec2vector *points, std::size_t n,
+                   const rect &bounds, polygonBatch &cells, unsigned threads = 0            );
+
+}
+
+#endif
+
+/*****************************************END*OF*FILE*********************************************/
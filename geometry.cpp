@@ -9,6 +9,7 @@
 // INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
 
 #include "geometry.h"
+#include "typed_line.h"
 #include "misc.h"
 
 #include <assert.h>
@@ -40,14 +41,7 @@ namespace TomsLibGeometry
   */
  bool parallel(line l1, line l2)
  {
-    switch (whichLinesYeqMxPlusC(l1, l2))
-    {
-     case both:    if (l1.m == l2.m       ) return true; break;
-     case first:   if (l1.m *  l2.m == 1.0) return true; break;
-     case second:  if (l1.m *  l2.m == 1.0) return true; break;
-     case neither: if (l1.m == l2.m       ) return true; break;
-    }
-    return false;
+    return dispatch(l1, l2, [](auto t1, auto t2) {return parallel(t1, t2);});
  }
 
  /*
@@ -90,36 +84,11 @@ namespace TomsLibGeometry
     assert(-1.000001 <= l1.m && l1.m <= 1.000001); // allow for rounding errors
     assert(-1.000001 <= l2.m && l2.m <= 1.000001); // allow for rounding errors
 
-    // PROBLEM: If test for parallel lines, then whichLinesYeq...() is invoked twice.  Inefficient.
-    //if (parallel(l1, l2))
-    //  error("Attempted to find intersection point of parallel lines.");
-
-    // find intersection point
-    rec2vector p;
-    switch (whichLinesYeqMxPlusC(l1, l2))
-    {
-     case both:
-       p.x = (l2.c - l1.c) / (l1.m - l2.m);
-       p.y = l1.m * p.x + l1.c;
-       break;
-
-     case first:
-       p.x = (l2.c + l2.m * l1.c) / (1 - l1.m * l2.m);
-       p.y = l1.m * p.x + l1.c;
-       break;
-
-     case second:
-       p.x = (l1.c + l1.m * l2.c) / (1 - l1.m * l2.m);
-       p.y = l2.m * p.x + l2.c;
-       break;
-
-     case neither:
-       p.y = (l2.c - l1.c) / (l1.m - l2.m);
-       p.x = l1.m * p.y + l1.c;
-       break;
-    }
+    // Parallel lines are not tested for here.  Callers that need the test should use
+    // parallel() and intersection() on the basicLines given by dispatch() ("typed_line.h"),
+    // so that the representations are examined only once.
 
-    return p;
+    return dispatch(l1, l2, [](auto t1, auto t2) {return intersection(t1, t2);});
  }
 
  /*
@@ -143,10 +112,10 @@ namespace TomsLibGeometry
 
     // find which sides to test for intersection
     enum {TL, TR, BL, BR} sides;
-         if (-pi     < a && a <= -pi / 2) sides = BL;
+         if (               a <= -pi / 2) sides = BL; // atan2() may return -pi
     else if (-pi / 2 < a && a <=  0     ) sides = BR;
     else if ( 0      < a && a <=  pi / 2) sides = TR;
-    else if ( pi / 2 < a && a <=  pi    ) sides = TL;
+    else                                  sides = TL;
 
     // find intersection point
     rec2vector p;
@@ -154,25 +123,25 @@ namespace TomsLibGeometry
     {
      case BL:
        p = intersection(line, lineB);
-       if (!(-1.0 <= p.x && p.x <= 1.0))
+       if (!(r.l <= p.x && p.x <= r.r))
          p = intersection(line, lineL);
        break;
 
      case BR:
        p = intersection(line, lineB);
-       if (!(-1.0 <= p.x && p.x <= 1.0))
+       if (!(r.l <= p.x && p.x <= r.r))
          p = intersection(line, lineR);
        break;
 
      case TR:
        p = intersection(line, lineT);
-       if (!(-1.0 <= p.x && p.x <= 1.0))
+       if (!(r.l <= p.x && p.x <= r.r))
          p = intersection(line, lineR);
        break;
 
      case TL:
        p = intersection(line, lineT);
-       if (!(-1.0 <= p.x && p.x <= 1.0))
+       if (!(r.l <= p.x && p.x <= r.r))
          p = intersection(line, lineL);
        break;
     }
@@ -188,40 +157,12 @@ namespace TomsLibGeometry
  {
     using TomsLibMisc::error;
 
-    rec2vector *soln = new rec2vector[2];
-
-    double a, b, c, det;
-
-    switch(l.rep)
-    {
-     case YeqMxPlusC:
-       a = -(1 + pow(l.m, 2));
-       b = 2.0 * (p.x - l.m * l.c + l.m * p.y);
-       c = pow(r, 2) - pow(p.x, 2) - pow(l.c, 2) - pow(p.y, 2) + 2.0 * l.c * p.y;
+    rec2vector (*soln)[2] = (rec2vector (*)[2])new rec2vector[2];
 
-       det = pow(b, 2) - 4 * a * c;
-       if (det < 0)
-         error("Determinant less than zero in findWhereP1HitP2() (YeqMxPlusC).");
+    if (!dispatch(l, [&](auto t) {return lineIntersectCirc(t, p, r, *soln);}))
+      error("Determinant less than zero in lineIntersectCirc().");
 
-       soln[0].x = (-b + sqrt(det)) / (2 * a); soln[0].y = l.m * soln[0].x + l.c;
-       soln[1].x = (-b - sqrt(det)) / (2 * a); soln[1].y = l.m * soln[1].x + l.c;
-       break;
-
-     case XeqMyPlusC:
-       a = -(1 + pow(l.m, 2));
-       b = 2.0 * (p.y - l.m * l.c + l.m * p.x);
-       c = pow(r, 2) - pow(p.y, 2) - pow(l.c, 2) - pow(p.x, 2) + 2.0 * l.c * p.x;
-
-       det = pow(b, 2) - 4 * a * c;
-       if (det < 0)
-         error("Determinant less than zero in findWhereP1HitP2() (XeqMyPlusC).");
-
-       soln[0].y = (-b + sqrt(det)) / (2 * a); soln[0].x = l.m * soln[0].y + l.c;
-       soln[1].y = (-b - sqrt(det)) / (2 * a); soln[1].x = l.m * soln[1].y + l.c;
-       break;
-    }
-
-    return (rec2vector (*)[2])soln;
+    return soln;
  }
 
  /*
@@ -229,20 +170,7 @@ namespace TomsLibGeometry
   */
  bool operator>(rec2vector p, line l)
  {
-    bool b;
-    switch (l.rep)
-    {
-     case YeqMxPlusC:
-       if (p.y > l.m * p.x + l.c) b = true;
-       else                       b = false;
-       break;
-
-     case XeqMyPlusC:
-       if (p.y > (1.0 / l.m) * p.x + l.c / l.m) b = true;
-       else                                     b = false;
-       break;
-    }
-    return b;
+    return dispatch(l, [&](auto t) {return p > t;});
  }
 
  /*
@@ -250,20 +178,7 @@ namespace TomsLibGeometry
   */
  bool operator<(rec2vector p, line l)
  {
-    bool b;
-    switch (l.rep)
-    {
-     case YeqMxPlusC:
-       if (p.y < l.m * p.x + l.c) b = true;
-       else                       b = false;
-       break;
-
-     case XeqMyPlusC:
-       if (p.y < (1.0 / l.m) * p.x + l.c / l.m) b = true;
-       else                                     b = false;
-       break;
-    }
-    return b;
+    return dispatch(l, [&](auto t) {return p < t;});
  }
 
 } // end namespace TomsLibGeometry
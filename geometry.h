@@ -27,6 +27,15 @@ namespace TomsLibGeometry
     double l, r, t, b; // x left, x right, y top, y bottom;
  };
 
+ /*
+  * Box class (3D equivalent of rect).
+  */
+ class box
+ {
+  public:
+    double l, r, t, b, n, f; // x left, x right, y top, y bottom, z near (min.), z far (max.)
+ };
+
  /*
   * Line representation.
   */
@@ -100,6 +109,26 @@ namespace TomsLibGeometry
     else                           return false;
  }
 
+ /*
+  * Return true if the interiors of rectangles a and b intersect (so that, as for
+  * insideRect(), rectangles that only touch at their edges do not overlap).
+  */
+ inline bool overlap(const rect &a, const rect &b)
+ {
+    return    a.l < b.r && b.l < a.r
+           && a.b < b.t && b.b < a.t;
+ }
+
+ /*
+  *
+  */
+ inline bool insideBox(rec3vector p, box b)
+ {
+    return    b.l < p.x && p.x < b.r
+           && b.b < p.y && p.y < b.t
+           && b.n < p.z && p.z < b.f;
+ }
+
  /*
   *
   */
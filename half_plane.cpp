@@ -0,0 +1,154 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "half_plane.cpp" -                                                                              *
+*                                                                                                 *
+*           Author - Tom McDonnell 2026                                                           *
+*                                                                                                 *
+\*************************************************************************************************/
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "half_plane.h"
+#include "simd.h"
+
+#include <algorithm>
+
+#include <cmath>
+
+// LOCAL FUNCTION DEFINITIONS /////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+ using TomsLibSimd::packd;
+ using TomsLibSimd::broadcast;
+ using TomsLibSimd::loadPartial;
+
+ /*
+  * Line rearranged so that a point is above it if ky * y > kx * x + k0, and below it if
+  * ky * y < kx * x + k0.
+  */
+ struct lineForm
+ {
+    double ky, kx, k0;
+ };
+
+ /*
+  * For x = my + c, y > (x - c) / m becomes my > x - c if m >= 0, or -my > -x + c if m < 0.
+  * With m = 0 (a vertical line) this gives the limits of operator>() and operator<() as m
+  * approaches 0 from the side of its sign.
+  */
+ static lineForm toLineForm(line l)
+ {
+    lineForm f;
+
+    if (l.rep == YeqMxPlusC)    {f.ky =  1.0; f.kx =  l.m; f.k0 =  l.c;}
+    else if (std::signbit(l.m)) {f.ky = -l.m; f.kx = -1.0; f.k0 =  l.c;}
+    else                        {f.ky =  l.m; f.kx =  1.0; f.k0 = -l.c;}
+
+    return f;
+ }
+
+ /*
+  * Return the mask of the first n (<= 64) bits of a word.
+  */
+ static std::uint64_t lowBits(std::size_t n)
+ {
+    return (n < 64)? (std::uint64_t(1) << n) - 1: ~std::uint64_t(0);
+ }
+
+} // end namespace TomsLibGeometry
+
+// GLOBAL FUNCTION DEFINITIONS ////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ std::size_t classify(const rec2vectorBatch &points, line l, pointMask &above, pointMask &below)
+ {
+    std::size_t n = points.size(), words = (n + 63) / 64, count = 0;
+    lineForm    f = toLineForm(l);
+    packd       ky = broadcast(f.ky), kx = broadcast(f.kx), k0 = broadcast(f.k0);
+
+    above.resize(words);
+    below.resize(words);
+
+    for (std::size_t w = 0; w < words; ++w)
+    {
+       std::size_t   begin = 64 * w, end = std::min(n, begin + 64);
+       std::uint64_t a = 0, b = 0;
+
+       for (std::size_t i = begin; i < end; i += packd::width)
+       {
+          packd x   = loadPartial(points.x.data() + i, end - i),
+                y   = loadPartial(points.y.data() + i, end - i),
+                lhs = ky * y,
+                rhs = kx * x + k0;
+
+          a |= std::uint64_t(movemask(cmpgt(lhs, rhs))) << (i - begin);
+          b |= std::uint64_t(movemask(cmplt(lhs, rhs))) << (i - begin);
+       }
+
+       above[w] = a & lowBits(end - begin);
+       below[w] = b & lowBits(end - begin);
+       count   += __builtin_popcountll(above[w]);
+    }
+
+    return count;
+ }
+
+ /*
+  * Half-planes are rearranged so that a point is inside each if ky * y >= kx * x + k0.
+  * Packs are tested against one half-plane after another until no point is left inside.
+  */
+ std::size_t classify(const rec2vectorBatch &points, const std::vector<halfPlane> &region,
+                      pointMask &inside                                                  )
+ {
+    std::size_t           n = points.size(), words = (n + 63) / 64, count = 0;
+    std::vector<lineForm> f(region.size());
+
+    for (std::size_t j = 0; j < region.size(); ++j)
+    {
+       f[j] = toLineForm(region[j].l);
+
+       if (!region[j].above)
+       {
+          f[j].ky = -f[j].ky;
+          f[j].kx = -f[j].kx;
+          f[j].k0 = -f[j].k0;
+       }
+    }
+
+    inside.resize(words);
+
+    for (std::size_t w = 0; w < words; ++w)
+    {
+       std::size_t   begin = 64 * w, end = std::min(n, begin + 64);
+       std::uint64_t in = 0;
+
+       for (std::size_t i = begin; i < end; i += packd::width)
+       {
+          packd x    = loadPartial(points.x.data() + i, end - i),
+                y    = loadPartial(points.y.data() + i, end - i),
+                mask = cmpeq(x, x) & cmpeq(y, y);
+
+          for (std::size_t j = 0; j < f.size() && movemask(mask) != 0; ++j)
+          {
+             packd lhs = broadcast(f[j].ky) * y,
+                   rhs = broadcast(f[j].kx) * x + broadcast(f[j].k0);
+
+             mask = mask & cmpge(lhs, rhs);
+          }
+
+          in |= std::uint64_t(movemask(mask)) << (i - begin);
+       }
+
+       inside[w] = in & lowBits(end - begin);
+       count    += __builtin_popcountll(inside[w]);
+    }
+
+    return count;
+ }
+
+} // end namespace TomsLibGeometry
+
+/*****************************************END*OF*FILE*********************************************/
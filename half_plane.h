@@ -0,0 +1,83 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "half_plane.h" - Classification of SIMD batches of points against lines and                     *
+*                  convex sets of half-planes, into packed bitmasks.                              *
+*                                                                                                 *
+*         Author - Tom McDonnell 2026                                                             *
+*                                                                                                 *
+\*************************************************************************************************/
+
+#ifndef TOMS_LIB_HALF_PLANE_H
+#define TOMS_LIB_HALF_PLANE_H
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "geometry.h"
+#include "vector_batch.h"
+
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+// GLOBAL TYPE DEFINITIONS ////////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ /*
+  * One bit per point: bit i % 64 of word i / 64 is set if point i is in the class.
+  * Bits past the last point are clear.
+  */
+ typedef std::vector<std::uint64_t> pointMask;
+
+ /*
+  * The points strictly above line l (in the sense of operator>(rec2vector, line)), or
+  * strictly below it if 'above' is false.
+  */
+ struct halfPlane
+ {
+    line l;
+    bool above;
+ };
+
+}
+
+// GLOBAL FUNCTION DECLARATIONS ///////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ // The line coefficients are rearranged once per call so that each point is classified by a
+ // multiply, an add and a compare, without division.  Results agree with operator>() and
+ // operator<() except possibly for points within rounding error of a line of
+ // representation XeqMyPlusC.  Masks are resized to match the input if necessary.
+
+ /*
+  * Set the bits of 'above' and 'below' for the points strictly above and below line l.
+  * Points on the line are in neither.  Return the number of points above.
+  */
+ std::size_t classify(const rec2vectorBatch &points, line l, pointMask &above, pointMask &below);
+
+ /*
+  * Set the bits of 'inside' for the points in the convex region that is the intersection of
+  * the closures of the given half-planes (so points on the boundary are inside).  Points
+  * with a NaN coordinate are never inside.  Return the number of points inside.
+  */
+ std::size_t classify(const rec2vectorBatch &points, const std::vector<halfPlane> &region,
+                      pointMask &inside                                                  );
+
+}
+
+// GLOBAL INLINE FUNCTION DEFINITIONS /////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ inline bool maskBit(const pointMask &m, std::size_t i) {return (m[i / 64] >> (i % 64)) & 1;}
+
+}
+
+#endif
+
+/*****************************************END*OF*FILE*********************************************/
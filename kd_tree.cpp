@@ -0,0 +1,295 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "kd_tree.cpp" -                                                                                 *
+*                                                                                                 *
+*        Author - Tom McDonnell 2026                                                              *
+*                                                                                                 *
+\*************************************************************************************************/
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "kd_tree.h"
+#include "parallel.h"
+#include "reduce.h"
+
+#include <algorithm>
+
+// LOCAL FUNCTION DEFINITIONS /////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+ using TomsLibParallel::parallelFor;
+ using TomsLibParallel::parallelTasks;
+ using TomsLibParallel::threadCount;
+
+ struct indexedPoint
+ {
+    double      c[2]; // x, y
+    std::size_t i;
+ };
+
+ /*
+  * A subtree waiting to be built: node 'node' of level 'level' over points [begin, end).
+  */
+ struct subtree
+ {
+    std::size_t node, begin, end;
+    int         level;
+    rect        cell;
+ };
+
+ /*
+  * Partition the points of node t.node about their median along the wider side of the node's
+  * cell, and recurse into its children.  Subtrees at level 'stopLevel' are appended to
+  * 'pending' rather than built, so that they can be built in parallel.
+  */
+ static void buildNode(indexedPoint *pts, std::vector<double> &split, std::vector<char> &axis,
+                       int depth, subtree t, int stopLevel, std::vector<subtree> *pending     )
+ {
+    if (t.level == depth) return;
+
+    if (t.level == stopLevel)
+    {
+       pending->push_back(t);
+       return;
+    }
+
+    int         a   = (t.cell.r - t.cell.l >= t.cell.t - t.cell.b)? 0: 1;
+    std::size_t mid = t.begin + (t.end - t.begin) / 2;
+
+    std::nth_element(pts + t.begin, pts + mid, pts + t.end,
+                     [a](const indexedPoint &p, const indexedPoint &q) {return p.c[a] < q.c[a];});
+
+    double s = pts[mid].c[a];
+
+    split[t.node] = s;
+    axis[t.node]  = char(a);
+
+    subtree lo = {2 * t.node + 1, t.begin, mid,   t.level + 1, t.cell},
+            hi = {2 * t.node + 2, mid,     t.end, t.level + 1, t.cell};
+
+    if (a == 0) {lo.cell.r = s; hi.cell.l = s;}
+    else        {lo.cell.t = s; hi.cell.b = s;}
+
+    buildNode(pts, split, axis, depth, lo, stopLevel, pending);
+    buildNode(pts, split, axis, depth, hi, stopLevel, pending);
+ }
+
+} // end namespace TomsLibGeometry
+
+// MEMBER FUNCTION DEFINITIONS ////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ /*
+  * The top levels are built on one thread until there are a few subtrees per thread, then
+  * the subtrees are built in parallel.
+  */
+ void kdTree::build(const rec2vector *v, std::size_t n, unsigned threads)
+ {
+    std::vector<indexedPoint> pts(n);
+    std::vector<subtree>      pending;
+
+    depth = 0;
+
+    for (std::size_t s = n; s > leafSize; s = (s + 1) / 2)
+      ++depth;
+
+    split.assign((std::size_t(1) << depth) - 1, 0.0);
+    axis.assign(split.size(), 0);
+    x.resize(n);
+    y.resize(n);
+    index.resize(n);
+
+    if (n == 0) return;
+
+    parallelFor(n, threads, [&](std::size_t begin, std::size_t end, unsigned)
+    {
+       for (std::size_t i = begin; i < end; ++i)
+       {
+          pts[i].c[0] = v[i].x;
+          pts[i].c[1] = v[i].y;
+          pts[i].i    = i;
+       }
+    });
+
+    int     stopLevel = 0;
+    subtree root      = {0, 0, n, 0, boundingRect(v, n, threads)};
+
+    while ((std::size_t(1) << stopLevel) < 4 * std::size_t(threadCount(n, threads)))
+      ++stopLevel;
+
+    buildNode(&pts[0], split, axis, depth, root, std::min(stopLevel, depth), &pending);
+
+    parallelTasks(pending.size(), threads, [&](std::size_t i)
+    {
+       buildNode(&pts[0], split, axis, depth, pending[i], -1, 0);
+    });
+
+    parallelFor(n, threads, [&](std::size_t begin, std::size_t end, unsigned)
+    {
+       for (std::size_t i = begin; i < end; ++i)
+       {
+          x[i]     = pts[i].c[0];
+          y[i]     = pts[i].c[1];
+          index[i] = pts[i].i;
+       }
+    });
+ }
+
+ void kdTree::rangeQuery(const rect &r, std::vector<std::size_t> &out) const
+ {
+    if (!empty()) rangeNode(0, 0, size(), 0, r, out);
+ }
+
+ void kdTree::radiusQuery(rec2vector p, double radius, std::vector<std::size_t> &out) const
+ {
+    if (!empty()) radiusNode(0, 0, size(), 0, p, radius * radius, out);
+ }
+
+ void kdTree::nearest(rec2vector p, std::size_t k, std::vector<std::size_t> &out) const
+ {
+    std::vector<candidate> heap;
+
+    out.clear();
+
+    if (empty() || k == 0) return;
+
+    heap.reserve(std::min(k, size()));
+    nearestNode(0, 0, size(), 0, p, k, heap);
+    std::sort_heap(heap.begin(), heap.end());
+
+    out.resize(heap.size());
+
+    for (std::size_t i = 0; i < heap.size(); ++i)
+      out[i] = index[heap[i].i];
+ }
+
+ std::size_t kdTree::nearest(rec2vector p) const
+ {
+    std::vector<candidate> heap;
+
+    heap.reserve(1);
+    nearestNode(0, 0, size(), 0, p, 1, heap);
+
+    return index[heap[0].i];
+ }
+
+ void kdTree::nearest(const rec2vector *q, std::size_t n, std::size_t *out,
+                      unsigned threads                                     ) const
+ {
+    parallelFor(n, threads, [&](std::size_t begin, std::size_t end, unsigned)
+    {
+       std::vector<candidate> heap;
+
+       heap.reserve(1);
+
+       for (std::size_t i = begin; i < end; ++i)
+       {
+          heap.clear();
+          nearestNode(0, 0, size(), 0, q[i], 1, heap);
+          out[i] = index[heap[0].i];
+       }
+    });
+ }
+
+ // Points before the split position of a node have coordinate <= split, points after
+ // have coordinate >= split.
+
+ void kdTree::rangeNode(std::size_t node, std::size_t begin, std::size_t end, int level,
+                        const rect &r, std::vector<std::size_t> &out                    ) const
+ {
+    if (level == depth)
+    {
+       for (std::size_t i = begin; i < end; ++i)
+         if (r.l < x[i] && x[i] < r.r && r.b < y[i] && y[i] < r.t)
+           out.push_back(index[i]);
+
+       return;
+    }
+
+    std::size_t mid = begin + (end - begin) / 2;
+    double      s   = split[node],
+                lo  = (axis[node] == 0)? r.l: r.b,
+                hi  = (axis[node] == 0)? r.r: r.t;
+
+    if (lo < s) rangeNode(2 * node + 1, begin, mid, level + 1, r, out);
+    if (hi > s) rangeNode(2 * node + 2, mid,   end, level + 1, r, out);
+ }
+
+ void kdTree::radiusNode(std::size_t node, std::size_t begin, std::size_t end, int level,
+                         rec2vector p, double r2, std::vector<std::size_t> &out         ) const
+ {
+    if (level == depth)
+    {
+       for (std::size_t i = begin; i < end; ++i)
+       {
+          double dx = x[i] - p.x,
+                 dy = y[i] - p.y;
+
+          if (dx * dx + dy * dy <= r2)
+            out.push_back(index[i]);
+       }
+
+       return;
+    }
+
+    std::size_t mid = begin + (end - begin) / 2;
+    double      d   = ((axis[node] == 0)? p.x: p.y) - split[node];
+
+    if (d <= 0 || d * d <= r2) radiusNode(2 * node + 1, begin, mid, level + 1, p, r2, out);
+    if (d >= 0 || d * d <= r2) radiusNode(2 * node + 2, mid,   end, level + 1, p, r2, out);
+ }
+
+ /*
+  * 'heap' is a max-heap (by squared distance) of the best candidates found so far.
+  */
+ void kdTree::nearestNode(std::size_t node, std::size_t begin, std::size_t end, int level,
+                          rec2vector p, std::size_t k, std::vector<candidate> &heap      ) const
+ {
+    if (level == depth)
+    {
+       for (std::size_t i = begin; i < end; ++i)
+       {
+          double    dx = x[i] - p.x,
+                    dy = y[i] - p.y;
+          candidate c  = {dx * dx + dy * dy, i};
+
+          if (heap.size() < k)
+          {
+             heap.push_back(c);
+             std::push_heap(heap.begin(), heap.end());
+          }
+          else if (c.d2 < heap.front().d2)
+          {
+             std::pop_heap(heap.begin(), heap.end());
+             heap.back() = c;
+             std::push_heap(heap.begin(), heap.end());
+          }
+       }
+
+       return;
+    }
+
+    std::size_t mid = begin + (end - begin) / 2;
+    double      d   = ((axis[node] == 0)? p.x: p.y) - split[node];
+
+    // search the side containing p first, then the other side if it could hold a nearer point
+    if (d <= 0)
+    {
+       nearestNode(2 * node + 1, begin, mid, level + 1, p, k, heap);
+       if (heap.size() < k || d * d < heap.front().d2)
+         nearestNode(2 * node + 2, mid, end, level + 1, p, k, heap);
+    }
+    else
+    {
+       nearestNode(2 * node + 2, mid, end, level + 1, p, k, heap);
+       if (heap.size() < k || d * d < heap.front().d2)
+         nearestNode(2 * node + 1, begin, mid, level + 1, p, k, heap);
+    }
+ }
+
+} // end namespace TomsLibGeometry
+
+/*****************************************END*OF*FILE*********************************************/
@@ -0,0 +1,113 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "kd_tree.h" - Static k-d tree over a set of rec2vectors, for rectangle range,                   *
+*               radius and nearest neighbour queries.                                             *
+*                                                                                                 *
+*      Author - Tom McDonnell 2026                                                                *
+*                                                                                                 *
+\*************************************************************************************************/
+
+#ifndef TOMS_LIB_KD_TREE_H
+#define TOMS_LIB_KD_TREE_H
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "geometry.h"
+#include "simd.h"
+#include "vector.h"
+
+#include <vector>
+
+#include <cstddef>
+
+// GLOBAL TYPE DEFINITIONS ////////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+ using TomsLibSimd::doubleArray;
+
+ /*
+  * Balanced bucket k-d tree, built once over an array of points.
+  *
+  * Each internal node splits its points at the median of the axis along which its cell is
+  * widest.  Nodes are stored implicitly (the children of node i are 2i + 1 and 2i + 2) and
+  * the points are stored in tree order as separate x and y arrays, so that each leaf of at
+  * most 'leafSize' points is contiguous.
+  *
+  * Queries report points by their indices in the array the tree was built from.
+  * A built tree is not modified by queries, so any number of threads may query it at once.
+  */
+ class kdTree
+ {
+  public:
+    static const std::size_t leafSize = 16;
+
+    kdTree(void): depth(0) {}
+    kdTree(const rec2vector *v, std::size_t n, unsigned threads = 0) {build(v, n, threads);}
+
+    /*
+     * (Re)build the tree over the n points at v, using 'threads' threads (0 = one per core).
+     */
+    void build(const rec2vector *v, std::size_t n, unsigned threads = 0);
+
+    std::size_t size(void)  const {return index.size();}
+    bool        empty(void) const {return index.empty();}
+
+    rec2vector point(std::size_t i) const {return rec2vector(x[i], y[i]);} // i in tree order
+
+    /*
+     * Append to 'out' the indices of the points p for which insideRect(p, r).
+     */
+    void rangeQuery(const rect &r, std::vector<std::size_t> &out) const;
+
+    /*
+     * Append to 'out' the indices of the points within distance 'radius' of p.
+     */
+    void radiusQuery(rec2vector p, double radius, std::vector<std::size_t> &out) const;
+
+    /*
+     * Set 'out' to the indices of the k points nearest p (fewer if the tree has fewer than k),
+     * nearest first.  Ties are broken arbitrarily.
+     */
+    void nearest(rec2vector p, std::size_t k, std::vector<std::size_t> &out) const;
+
+    /*
+     * Return the index of the point nearest p.  The tree must not be empty.
+     */
+    std::size_t nearest(rec2vector p) const;
+
+    /*
+     * out[i] = nearest(q[i]) for each of the n query points, using 'threads' threads.
+     */
+    void nearest(const rec2vector *q, std::size_t n, std::size_t *out, unsigned threads = 0) const;
+
+  private:
+    struct candidate
+    {
+       double      d2;   // squared distance
+       std::size_t i;    // position in tree order
+
+       bool operator<(const candidate &c) const {return d2 < c.d2;}
+    };
+
+    void rangeNode(std::size_t node, std::size_t begin, std::size_t end, int level,
+                   const rect &r, std::vector<std::size_t> &out                    ) const;
+
+    void radiusNode(std::size_t node, std::size_t begin, std::size_t end, int level,
+                    rec2vector p, double r2, std::vector<std::size_t> &out         ) const;
+
+    void nearestNode(std::size_t node, std::size_t begin, std::size_t end, int level,
+                     rec2vector p, std::size_t k, std::vector<candidate> &heap      ) const;
+
+    int                      depth; // levels of internal nodes
+    std::vector<double>      split; // split coordinate of each internal node
+    std::vector<char>        axis;  // split axis of each internal node (0 = x, 1 = y)
+    doubleArray              x, y;  // points in tree order
+    std::vector<std::size_t> index; // index[i] = index in the original array of point i
+ };
+
+} // end namespace TomsLibGeometry
+
+#endif
+
+/*****************************************END*OF*FILE*********************************************/
@@ -0,0 +1,168 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "line_batch.cpp" -                                                                              *
+*                                                                                                 *
+*           Author - Tom McDonnell 2026                                                           *
+*                                                                                                 *
+\*************************************************************************************************/
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "line_batch.h"
+
+#include <limits>
+
+#include <cassert>
+
+// LOCAL FUNCTION DEFINITIONS /////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+ using TomsLibSimd::packd;
+ using TomsLibSimd::broadcast;
+ using TomsLibSimd::loadPartial;
+ using TomsLibSimd::storePartial;
+
+ /*
+  * Coefficients of a pack of lines written as ax + by = c.
+  * y = mx + c becomes -mx + y = c, and x = my + c becomes x - my = c.
+  */
+ class packedLines
+ {
+  public:
+    packedLines(packd m, packd c1, packd xRep): c(c1)
+    {
+       packd isX = cmpgt(xRep, broadcast(0.5)),
+             one = broadcast(1.0);
+
+       a = select(isX, one, -m);
+       b = select(isX, -m, one);
+    }
+
+    packedLines(const lineBatch &l, std::size_t i, std::size_t n)
+    {
+       *this = packedLines(loadPartial(l.m.data()    + i, n),
+                           loadPartial(l.c.data()    + i, n),
+                           loadPartial(l.xRep.data() + i, n));
+    }
+
+    packd a, b, c;
+ };
+
+ /*
+  * Intersect pairs of lines by Cramer's rule, so all four combinations of representation
+  * are handled by the same arithmetic.  Return a mask of the parallel pairs.
+  */
+ static packd intersect(const packedLines &l1, const packedLines &l2, packd tolerance,
+                        packd &x, packd &y                                           )
+ {
+    packd det = l1.a * l2.b - l2.a * l1.b,
+          par = cmple(abs(det), tolerance),
+          nan = broadcast(std::numeric_limits<double>::quiet_NaN()),
+          inv = broadcast(1.0) / select(par, broadcast(1.0), det);
+
+    x = select(par, nan, (l1.c * l2.b - l2.c * l1.b) * inv);
+    y = select(par, nan, (l1.a * l2.c - l2.a * l1.c) * inv);
+
+    return par;
+ }
+
+ /*
+  * Write the point and parallel flags for the n (at most packd::width) pairs at i.
+  * Return the number of parallel pairs.
+  */
+ static std::size_t storeResult(packd x, packd y, packd par, std::size_t i, std::size_t n,
+                                rec2vectorBatch &out, unsigned char *parallel            )
+ {
+    int         bits  = movemask(par);
+    std::size_t count = 0;
+
+    storePartial(out.x.data() + i, x, n);
+    storePartial(out.y.data() + i, y, n);
+
+    for (int k = 0; k < packd::width && std::size_t(k) < n; ++k)
+    {
+       parallel[i + k] = (bits >> k) & 1;
+       count          += (bits >> k) & 1;
+    }
+
+    return count;
+ }
+
+} // end namespace TomsLibGeometry
+
+// MEMBER FUNCTION DEFINITIONS ////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ void lineBatch::assign(const std::vector<line> &l)
+ {
+    resize(l.size());
+
+    for (std::size_t i = 0; i < l.size(); ++i)
+      set(i, l[i]);
+ }
+
+ std::vector<line> lineBatch::toVector(void) const
+ {
+    std::vector<line> l(size());
+
+    for (std::size_t i = 0; i < l.size(); ++i)
+      l[i] = get(i);
+
+    return l;
+ }
+
+} // end namespace TomsLibGeometry
+
+// GLOBAL FUNCTION DEFINITIONS ////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ std::size_t intersection(const lineBatch &l1, const lineBatch &l2, rec2vectorBatch &out,
+                          std::vector<unsigned char> &parallel, double tolerance        )
+ {
+    std::size_t n = l1.size(), count = 0;
+    packd       tol = broadcast(tolerance), x, y;
+
+    assert(l2.size() == n);
+
+    out.resize(n);
+    parallel.resize(n);
+
+    for (std::size_t i = 0; i < n; i += packd::width)
+    {
+       packd par = intersect(packedLines(l1, i, n - i), packedLines(l2, i, n - i), tol, x, y);
+
+       count += storeResult(x, y, par, i, n - i, out, parallel.data());
+    }
+
+    return count;
+ }
+
+ std::size_t intersection(line l, const lineBatch &lines, rec2vectorBatch &out,
+                          std::vector<unsigned char> &parallel, double tolerance)
+ {
+    std::size_t n = lines.size(), count = 0;
+    packd       tol = broadcast(tolerance), x, y;
+    packedLines l1(broadcast(l.m), broadcast(l.c),
+                   broadcast((l.rep == XeqMyPlusC)? 1.0: 0.0));
+
+    out.resize(n);
+    parallel.resize(n);
+
+    for (std::size_t i = 0; i < n; i += packd::width)
+    {
+       packd par = intersect(l1, packedLines(lines, i, n - i), tol, x, y);
+
+       count += storeResult(x, y, par, i, n - i, out, parallel.data());
+    }
+
+    return count;
+ }
+
+} // end namespace TomsLibGeometry
+
+/*****************************************END*OF*FILE*********************************************/
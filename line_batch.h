@@ -0,0 +1,117 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "line_batch.h" - Structure-of-arrays container for large numbers of lines, and                  *
+*                  SIMD line intersection kernels over it.                                        *
+*                                                                                                 *
+*         Author - Tom McDonnell 2026                                                             *
+*                                                                                                 *
+\*************************************************************************************************/
+
+#ifndef TOMS_LIB_LINE_BATCH_H
+#define TOMS_LIB_LINE_BATCH_H
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "geometry.h"
+#include "vector_batch.h"
+#include "simd.h"
+
+#include <vector>
+
+#include <cstddef>
+
+// GLOBAL CONSTANTS ///////////////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ /*
+  * Default tolerance below which pairs of lines are treated as parallel (see intersection()).
+  */
+ const double parallelTolerance = 1e-12;
+
+}
+
+// GLOBAL TYPE DEFINITIONS ////////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+ using TomsLibSimd::doubleArray;
+
+ /*
+  * Array of lines stored as separate contiguous aligned arrays of m, c and representation.
+  * The representation is stored as a double (xRep[i] = 1 if line i is x = my + c, 0 if
+  * y = mx + c) so that kernels can select on it without branching.
+  */
+ class lineBatch
+ {
+  public:
+    lineBatch(void) {}
+    explicit lineBatch(std::size_t n): m(n), c(n), xRep(n) {}
+    lineBatch(const std::vector<line> &l) {assign(l);}
+
+    std::size_t size(void)  const {return m.size();}
+    bool        empty(void) const {return m.empty();}
+
+    void resize(std::size_t n)  {m.resize(n);  c.resize(n);  xRep.resize(n); }
+    void reserve(std::size_t n) {m.reserve(n); c.reserve(n); xRep.reserve(n);}
+    void clear(void)            {m.clear();    c.clear();    xRep.clear();   }
+
+    void append(line l)
+    {
+       m.push_back(l.m); c.push_back(l.c); xRep.push_back((l.rep == XeqMyPlusC)? 1.0: 0.0);
+    }
+
+    line get(std::size_t i) const
+    {
+       return line(m[i], c[i], (xRep[i] != 0)? XeqMyPlusC: YeqMxPlusC);
+    }
+
+    void set(std::size_t i, line l)
+    {
+       m[i] = l.m; c[i] = l.c; xRep[i] = (l.rep == XeqMyPlusC)? 1.0: 0.0;
+    }
+
+    void              assign(const std::vector<line> &);
+    std::vector<line> toVector(void) const;
+
+    doubleArray m, c, xRep;
+ };
+
+} // end namespace TomsLibGeometry
+
+// GLOBAL FUNCTION DECLARATIONS ///////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ // Batch equivalents of intersection(line, line).
+ // Element i of 'out' is set to the intersection of the ith pair of lines, and parallel[i] to
+ // 1 if the pair is parallel or near parallel, else 0.  Points of parallel pairs are set to
+ // NaN.  'out' and 'parallel' are resized to match the input if necessary.
+ //
+ // With each line written as ax + by = c, the pair is treated as parallel if
+ // |a1 b2 - a2 b1| <= tolerance.  Since |m| <= 1, this is roughly the sine of the angle
+ // between the lines.
+ //
+ // Return the number of parallel pairs.
+
+ /*
+  * Intersect l1[i] with l2[i] for each i.  The batches must be the same size.
+  */
+ std::size_t intersection(const lineBatch &l1, const lineBatch &l2, rec2vectorBatch &out,
+                          std::vector<unsigned char> &parallel,
+                          double tolerance = parallelTolerance                          );
+
+ /*
+  * Intersect l with each of 'lines'.
+  */
+ std::size_t intersection(line l, const lineBatch &lines, rec2vectorBatch &out,
+                          std::vector<unsigned char> &parallel,
+                          double tolerance = parallelTolerance                 );
+
+} // end namespace TomsLibGeometry
+
+#endif
+
+/*****************************************END*OF*FILE*********************************************/
@@ -0,0 +1,180 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "line_circle.cpp" -                                                                             *
+*                                                                                                 *
+*            Author - Tom McDonnell 2026                                                          *
+*                                                                                                 *
+\*************************************************************************************************/
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "line_circle.h"
+
+#include <limits>
+
+#include <cassert>
+
+// LOCAL FUNCTION DEFINITIONS /////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+ using TomsLibSimd::packd;
+ using TomsLibSimd::broadcast;
+ using TomsLibSimd::loadPartial;
+ using TomsLibSimd::storePartial;
+
+ /*
+  * Intersect a pack of lines (m, c, xRep as in lineBatch) with a pack of circles.
+  *
+  * A line is written v = mu + c, where (u, v) = (x, y) for y = mx + c and (y, x) for
+  * x = my + c, and the circle centre is swapped to match, so both representations use the
+  * quadratic in u of lineIntersectCirc() for y = mx + c.  Return a mask of the lanes with
+  * hits (det >= 0), and set 'tangent' to the mask of lanes with det = 0, where det is a
+  * quarter of the discriminant.
+  *
+  * The scalar and the batch forms of lineCircleIntersection() both go through here, so that
+  * they agree on which lines miss and which are tangents.  Every multiply-add is an explicit
+  * fma(), so that agreement does not depend on how the compiler contracts each inlined copy.
+  */
+ static packd intersectPack(packd m, packd c, packd xRep, packd px, packd py, packd r,
+                            packd &x0, packd &y0, packd &x1, packd &y1, packd &tangent)
+ {
+    packd isX  = cmpgt(xRep, broadcast(0.5)),
+          pu   = select(isX, py, px),
+          pv   = select(isX, px, py),
+          d    = pv - c,
+          zero = broadcast(0.0),
+          nan  = broadcast(std::numeric_limits<double>::quiet_NaN()),
+          a    = -fma(m, m, broadcast(1.0)),
+          hb   = fma(m, d, pu),
+          k    = fma(r, r, -fma(pu, pu, d * d)),
+          det  = fma(hb, hb, -(a * k)),
+          hit  = cmpge(det, zero),
+          s    = sqrt(max(det, zero)),
+          inv  = broadcast(1.0) / a,
+          u0   = (s - hb) * inv,
+          u1   = (-hb - s) * inv,
+          v0   = fma(m, u0, c),
+          v1   = fma(m, u1, c);
+
+    tangent = cmpeq(det, zero);
+
+    x0 = select(hit, select(isX, v0, u0), nan);
+    y0 = select(hit, select(isX, u0, v0), nan);
+    x1 = select(hit, select(isX, v1, u1), nan);
+    y1 = select(hit, select(isX, u1, v1), nan);
+
+    return hit;
+ }
+
+ /*
+  * Write the results for the n (at most packd::width) elements at i, and return the number
+  * hit.
+  */
+ static std::size_t storeHits(packd x0, packd y0, packd x1, packd y1, packd hit, packd tangent,
+                              std::size_t i, std::size_t n, rec2vectorBatch &p0,
+                              rec2vectorBatch &p1, unsigned char *hits                        )
+ {
+    int         h = movemask(hit), t = movemask(tangent);
+    std::size_t count = 0;
+
+    storePartial(p0.x.data() + i, x0, n);
+    storePartial(p0.y.data() + i, y0, n);
+    storePartial(p1.x.data() + i, x1, n);
+    storePartial(p1.y.data() + i, y1, n);
+
+    for (int k = 0; k < packd::width && std::size_t(k) < n; ++k)
+    {
+       hits[i + k] = ((h >> k) & 1) * (((t >> k) & 1)? 1: 2);
+       count      += (h >> k) & 1;
+    }
+
+    return count;
+ }
+
+} // end namespace TomsLibGeometry
+
+// GLOBAL FUNCTION DEFINITIONS ////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ lineCircleHits lineCircleIntersection(const line &l, rec2vector centre, double radius)
+ {
+    lineCircleHits h;
+    packd          x0, y0, x1, y1, tangent,
+                   hit = intersectPack(broadcast(l.m), broadcast(l.c),
+                                       broadcast((l.rep == XeqMyPlusC)? 1.0: 0.0),
+                                       broadcast(centre.x), broadcast(centre.y),
+                                       broadcast(radius), x0, y0, x1, y1, tangent);
+    double         v[4][packd::width];
+
+    TomsLibSimd::storeu(v[0], x0);
+    TomsLibSimd::storeu(v[1], y0);
+    TomsLibSimd::storeu(v[2], x1);
+    TomsLibSimd::storeu(v[3], y1);
+
+    h.p[0]  = rec2vector(v[0][0], v[1][0]);
+    h.p[1]  = rec2vector(v[2][0], v[3][0]);
+    h.count = ((movemask(hit) & 1) == 0)? 0: ((movemask(tangent) & 1)? 1: 2);
+
+    return h;
+ }
+
+ std::size_t lineCircleIntersection(line l, const rec2vectorBatch &centres,
+                                    const TomsLibSimd::doubleArray &radii,
+                                    rec2vectorBatch &p0, rec2vectorBatch &p1,
+                                    std::vector<unsigned char> &hits          )
+ {
+    std::size_t n = centres.size(), count = 0;
+    packd       m = broadcast(l.m), c = broadcast(l.c),
+                xRep = broadcast((l.rep == XeqMyPlusC)? 1.0: 0.0),
+                x0, y0, x1, y1, tangent;
+
+    assert(radii.size() == n);
+
+    p0.resize(n);
+    p1.resize(n);
+    hits.resize(n);
+
+    for (std::size_t i = 0; i < n; i += packd::width)
+    {
+       packd hit = intersectPack(m, c, xRep, loadPartial(centres.x.data() + i, n - i),
+                                 loadPartial(centres.y.data() + i, n - i),
+                                 loadPartial(radii.data() + i, n - i),
+                                 x0, y0, x1, y1, tangent);
+
+       count += storeHits(x0, y0, x1, y1, hit, tangent, i, n - i, p0, p1, hits.data());
+    }
+
+    return count;
+ }
+
+ std::size_t lineCircleIntersection(const lineBatch &lines, rec2vector centre, double radius,
+                                    rec2vectorBatch &p0, rec2vectorBatch &p1,
+                                    std::vector<unsigned char> &hits                         )
+ {
+    std::size_t n = lines.size(), count = 0;
+    packd       px = broadcast(centre.x), py = broadcast(centre.y), r = broadcast(radius),
+                x0, y0, x1, y1, tangent;
+
+    p0.resize(n);
+    p1.resize(n);
+    hits.resize(n);
+
+    for (std::size_t i = 0; i < n; i += packd::width)
+    {
+       packd hit = intersectPack(loadPartial(lines.m.data() + i, n - i),
+                                 loadPartial(lines.c.data() + i, n - i),
+                                 loadPartial(lines.xRep.data() + i, n - i),
+                                 px, py, r, x0, y0, x1, y1, tangent);
+
+       count += storeHits(x0, y0, x1, y1, hit, tangent, i, n - i, p0, p1, hits.data());
+    }
+
+    return count;
+ }
+
+} // end namespace TomsLibGeometry
+
+/*****************************************END*OF*FILE*********************************************/
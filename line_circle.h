@@ -0,0 +1,96 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "line_circle.h" - Intersection of lines with circles, returning the hits by value,              *
+*                   for single lines and circles and SIMD batches of either.                      *
+*                                                                                                 *
+*          Author - Tom McDonnell 2026                                                            *
+*                                                                                                 *
+\*************************************************************************************************/
+
+#ifndef TOMS_LIB_LINE_CIRCLE_H
+#define TOMS_LIB_LINE_CIRCLE_H
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "geometry.h"
+#include "line_batch.h"
+#include "typed_line.h"
+#include "vector_batch.h"
+#include "simd.h"
+
+#include <vector>
+
+#include <cstddef>
+
+// GLOBAL TYPE DEFINITIONS ////////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ /*
+  * Points where a line meets a circle.  p[0] and p[1] are valid for the first 'count'
+  * points (count = 0 for a miss, 1 for a tangent, 2 otherwise).  A tangent is a line for
+  * which the discriminant of the quadratic is exactly zero.
+  */
+ struct lineCircleHits
+ {
+    int        count;
+    rec2vector p[2];
+ };
+
+}
+
+// GLOBAL FUNCTION DECLARATIONS ///////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ /*
+  * Return the points where line l meets the circle centred at 'centre' with radius 'radius'.
+  * Unlike lineIntersectCirc(const line &, ...), allocates nothing and reports a miss
+  * rather than exiting.
+  */
+ lineCircleHits lineCircleIntersection(const line &l, rec2vector centre, double radius);
+
+ // Batch forms of lineCircleIntersection().
+ // Circle (or line) i gives hits[i] = number of points where it meets the line (or circle),
+ // and points p0[i] and p1[i], which are NaN if absent.  The points of two hits are in the same
+ // order as from lineCircleIntersection().  Outputs are resized to match the input if
+ // necessary.  Return the number of circles (or lines) hit.
+
+ /*
+  * Intersect line l with the circles of the given centres and radii (of the same size).
+  */
+ std::size_t lineCircleIntersection(line l, const rec2vectorBatch &centres,
+                                    const TomsLibSimd::doubleArray &radii,
+                                    rec2vectorBatch &p0, rec2vectorBatch &p1,
+                                    std::vector<unsigned char> &hits          );
+
+ /*
+  * Intersect each of 'lines' with the circle of the given centre and radius.
+  */
+ std::size_t lineCircleIntersection(const lineBatch &lines, rec2vector centre, double radius,
+                                    rec2vectorBatch &p0, rec2vectorBatch &p1,
+                                    std::vector<unsigned char> &hits                         );
+
+}
+
+// GLOBAL INLINE FUNCTION DEFINITIONS /////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ /*
+  * As lineCircleIntersection(const line &, ...).
+  */
+ template<lineRep R>
+ inline lineCircleHits lineCircleIntersection(basicLine<R> l, rec2vector centre, double radius)
+ {
+    return lineCircleIntersection(line(l), centre, radius);
+ }
+
+} // end namespace TomsLibGeometry
+
+#endif
+
+/*****************************************END*OF*FILE*********************************************/
@@ -0,0 +1,138 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "parallel.h" - Splitting loops over large arrays across threads.                                *
+*                                                                                                 *
+*       Author - Tom McDonnell 2026                                                               *
+*                                                                                                 *
+\*************************************************************************************************/
+
+#ifndef TOMS_LIB_PARALLEL_H
+#define TOMS_LIB_PARALLEL_H
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <cstddef>
+
+// GLOBAL CONSTANTS ///////////////////////////////////////////////////////////////////////////////
+
+namespace TomsLibParallel
+{
+
+ /*
+  * Fewest elements worth giving a thread of its own.  Smaller ranges run on fewer threads.
+  */
+ const std::size_t minElementsPerThread = 16384;
+
+}
+
+// GLOBAL TYPE DEFINITIONS ////////////////////////////////////////////////////////////////////////
+
+namespace TomsLibParallel
+{
+
+ /*
+  * Per-thread value padded to a cache line, so that threads updating neighbouring
+  * partial results do not share cache lines.
+  */
+ template<class T>
+ struct alignas(64) padded
+ {
+    T value;
+ };
+
+}
+
+// GLOBAL INLINE FUNCTION DEFINITIONS /////////////////////////////////////////////////////////////
+
+namespace TomsLibParallel
+{
+
+ /*
+  * Return the number of threads to use when the caller asks for 'threads' (0 = one per core).
+  */
+ inline unsigned threadCount(unsigned threads = 0)
+ {
+    if (threads == 0)
+      threads = std::thread::hardware_concurrency();
+
+    return (threads == 0)? 1: threads;
+ }
+
+ /*
+  * Return the number of threads actually used by parallelFor() for n elements.
+  */
+ inline unsigned threadCount(std::size_t n, unsigned threads)
+ {
+    std::size_t most = n / minElementsPerThread;
+
+    threads = threadCount(threads);
+
+    if (most < threads)
+      threads = (most == 0)? 1: unsigned(most);
+
+    return threads;
+ }
+
+ /*
+  * Split [0, n) into threadCount(n, threads) contiguous ranges of near equal size and call
+  * f(begin, end, t) for range t on its own thread (range 0 on the calling thread).
+  * Returns when all ranges are done.  f must not throw.
+  */
+ template<class F>
+ inline void parallelFor(std::size_t n, unsigned threads, F f)
+ {
+    unsigned                 count = threadCount(n, threads);
+    std::vector<std::thread> pool;
+
+    pool.reserve(count - 1);
+
+    for (unsigned t = 1; t < count; ++t)
+      pool.push_back(std::thread(f, n * t / count, n * (t + 1) / count, t));
+
+    f(std::size_t(0), n / count, 0u);
+
+    for (std::size_t t = 0; t < pool.size(); ++t)
+      pool[t].join();
+ }
+
+ /*
+  * Call f(i) for each i in [0, n) using min(threadCount(threads), n) threads (the calling
+  * thread being one of them).  Each thread takes the next i not yet taken, so tasks of
+  * uneven cost are balanced.  Returns when all calls are done.  f must not throw.
+  */
+ template<class F>
+ inline void parallelTasks(std::size_t n, unsigned threads, F f)
+ {
+    unsigned                 count = threadCount(threads);
+    std::atomic<std::size_t> next(0);
+    std::vector<std::thread> pool;
+
+    if (n < count)
+      count = (n == 0)? 1: unsigned(n);
+
+    auto worker = [&](void)
+    {
+       for (std::size_t i = next++; i < n; i = next++)
+         f(i);
+    };
+
+    pool.reserve(count - 1);
+
+    for (unsigned t = 1; t < count; ++t)
+      pool.push_back(std::thread(worker));
+
+    worker();
+
+    for (std::size_t t = 0; t < pool.size(); ++t)
+      pool[t].join();
+ }
+
+} // end namespace TomsLibParallel
+
+#endif
+
+/*****************************************END*OF*FILE*********************************************/
@@ -0,0 +1,244 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "polygon.cpp" -                                                                                 *
+*                                                                                                 *
+*        Author - Tom McDonnell 2026                                                              *
+*                                                                                                 *
+\*************************************************************************************************/
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "polygon.h"
+#include "parallel.h"
+#include "predicates.h"
+
+#include <algorithm>
+
+// LOCAL FUNCTION DEFINITIONS /////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+ using TomsLibParallel::parallelFor;
+ using TomsLibParallel::threadCount;
+ using TomsLibSimd::packd;
+ using TomsLibSimd::broadcast;
+ using TomsLibSimd::loadPartial;
+
+ static bool lexLess(rec2vector a, rec2vector b) {return a.x < b.x || (a.x == b.x && a.y < b.y);}
+
+ /*
+  * Sort points and remove duplicates.
+  */
+ static void sortPoints(std::vector<rec2vector> &p)
+ {
+    std::sort(p.begin(), p.end(), lexLess);
+    p.erase(std::unique(p.begin(), p.end()), p.end());
+ }
+
+ /*
+  * Set 'hull' to the convex hull of the sorted distinct points p.
+  */
+ static void monotoneChain(const std::vector<rec2vector> &p, std::vector<rec2vector> &hull)
+ {
+    std::size_t n = p.size(), k = 0;
+
+    if (n < 3)
+    {
+       hull = p;
+       return;
+    }
+
+    hull.resize(2 * n);
+
+    // lower hull, left to right
+    for (std::size_t i = 0; i < n; ++i)
+    {
+       while (k >= 2 && orient(hull[k - 2], hull[k - 1], p[i]) <= 0)
+         --k;
+
+       hull[k++] = p[i];
+    }
+
+    // upper hull, right to left
+    for (std::size_t i = n - 1, lower = k + 1; i-- > 0;)
+    {
+       while (k >= lower && orient(hull[k - 2], hull[k - 1], p[i]) <= 0)
+         --k;
+
+       hull[k++] = p[i];
+    }
+
+    hull.resize(k - 1); // the last point is the first
+ }
+
+ /*
+  * Return the bits of the points [begin, end) (at most 64) inside the polygon of 'edges'.
+  */
+ static std::uint64_t insideBits(const rec2vectorBatch &points, const polygonEdges &edges,
+                                 std::size_t begin, std::size_t end                      )
+ {
+    packd         l = broadcast(edges.box.l), r = broadcast(edges.box.r),
+                  b = broadcast(edges.box.b), t = broadcast(edges.box.t);
+    std::uint64_t bits = 0;
+
+    for (std::size_t i = begin; i < end; i += packd::width)
+    {
+       packd x  = loadPartial(points.x.data() + i, end - i),
+             y  = loadPartial(points.y.data() + i, end - i),
+             in = cmple(l, x) & cmple(x, r) & cmple(b, y) & cmple(y, t);
+
+       if (movemask(in) == 0) continue;
+
+       packd odd = broadcast(0.0);
+
+       for (std::size_t j = 0; j < edges.size(); ++j)
+       {
+          packd yLow = broadcast(edges.yLow[j]),
+                cut  = broadcast(edges.x0[j]) + broadcast(edges.m[j]) * (y - yLow);
+
+          odd = odd ^ (cmpge(y, yLow) & cmplt(y, broadcast(edges.yHigh[j])) & cmplt(x, cut));
+       }
+
+       bits |= std::uint64_t(movemask(in & odd)) << (i - begin);
+    }
+
+    return (end - begin < 64)? bits & ((std::uint64_t(1) << (end - begin)) - 1): bits;
+ }
+
+} // end namespace TomsLibGeometry
+
+// MEMBER FUNCTION DEFINITIONS ////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ double polygon::area(void) const
+ {
+    double      sum = 0;
+    std::size_t n   = vertices.size();
+
+    for (std::size_t i = 0, j = n - 1; i < n; j = i++)
+      sum += vertices[j].x * vertices[i].y - vertices[i].x * vertices[j].y;
+
+    return 0.5 * sum;
+ }
+
+ rect polygon::bounds(void) const
+ {
+    rect r;
+
+    if (vertices.empty())
+    {
+       r.l = r.r = r.b = r.t = 0;
+       return r;
+    }
+
+    r.l = r.r = vertices[0].x;
+    r.b = r.t = vertices[0].y;
+
+    for (std::size_t i = 1; i < vertices.size(); ++i)
+    {
+       r.l = std::min(r.l, vertices[i].x); r.r = std::max(r.r, vertices[i].x);
+       r.b = std::min(r.b, vertices[i].y); r.t = std::max(r.t, vertices[i].y);
+    }
+
+    return r;
+ }
+
+ void polygonEdges::assign(const polygon &p)
+ {
+    std::size_t n = p.size();
+
+    box = p.bounds();
+    yLow.clear(); yHigh.clear(); x0.clear(); m.clear();
+
+    for (std::size_t i = 0, j = n - 1; i < n; j = i++)
+    {
+       rec2vector a = p.vertices[j], b = p.vertices[i];
+
+       if (a.y == b.y) continue;
+       if (a.y >  b.y) std::swap(a, b);
+
+       yLow.push_back(a.y);
+       yHigh.push_back(b.y);
+       x0.push_back(a.x);
+       m.push_back((b.x - a.x) / (b.y - a.y));
+    }
+ }
+
+ /*
+  * Scalar form of the test made by classify().
+  */
+ bool polygonEdges::contains(rec2vector p) const
+ {
+    if (!(box.l <= p.x && p.x <= box.r && box.b <= p.y && p.y <= box.t)) return false;
+
+    bool odd = false;
+
+    for (std::size_t j = 0; j < size(); ++j)
+      odd ^= (yLow[j] <= p.y && p.y < yHigh[j] && p.x < x0[j] + m[j] * (p.y - yLow[j]));
+
+    return odd;
+ }
+
+} // end namespace TomsLibGeometry
+
+// GLOBAL FUNCTION DEFINITIONS ////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ polygon convexHull(const rec2vector *v, std::size_t n, unsigned threads)
+ {
+    unsigned                             count = threadCount(n, threads);
+    std::vector<std::vector<rec2vector> > hulls(count);
+    std::vector<rec2vector>              points;
+    polygon                              hull;
+
+    if (count > 1)
+    {
+       parallelFor(n, threads, [&](std::size_t begin, std::size_t end, unsigned t)
+       {
+          std::vector<rec2vector> part(v + begin, v + end);
+
+          sortPoints(part);
+          monotoneChain(part, hulls[t]);
+       });
+
+       for (unsigned t = 0; t < count; ++t)
+         points.insert(points.end(), hulls[t].begin(), hulls[t].end());
+    }
+    else
+      points.assign(v, v + n);
+
+    sortPoints(points);
+    monotoneChain(points, hull.vertices);
+
+    return hull;
+ }
+
+ std::size_t classify(const rec2vectorBatch &points, const polygonEdges &edges,
+                      pointMask &inside, unsigned threads                      )
+ {
+    std::size_t n = points.size(), words = (n + 63) / 64;
+
+    inside.resize(words);
+
+    // ranges of points rounded up to whole words
+    parallelFor(n, threads, [&](std::size_t begin, std::size_t end, unsigned)
+    {
+       for (std::size_t w = (begin + 63) / 64; w < (end + 63) / 64; ++w)
+         inside[w] = insideBits(points, edges, 64 * w, std::min(n, 64 * w + 64));
+    });
+
+    std::size_t count = 0;
+
+    for (std::size_t w = 0; w < words; ++w)
+      count += __builtin_popcountll(inside[w]);
+
+    return count;
+ }
+
+} // end namespace TomsLibGeometry
+
+/*****************************************END*OF*FILE*********************************************/
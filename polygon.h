@@ -0,0 +1,153 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "polygon.h" - Polygon type, parallel convex hull and batch point-in-polygon tests               *
+*               over precomputed edge tables.                                                     *
+*                                                                                                 *
+*      Author - Tom McDonnell 2026                                                                *
+*                                                                                                 *
+\*************************************************************************************************/
+
+#ifndef TOMS_LIB_POLYGON_H
+#define TOMS_LIB_POLYGON_H
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "geometry.h"
+#include "half_plane.h"
+#include "vector_batch.h"
+#include "simd.h"
+
+#include <vector>
+
+#include <cstddef>
+
+// GLOBAL TYPE DEFINITIONS ////////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+ using TomsLibSimd::doubleArray;
+
+ /*
+  * Simple polygon given by its vertices in order (either direction).  The last vertex is
+  * joined to the first.
+  */
+ class polygon
+ {
+  public:
+    polygon(void) {}
+    explicit polygon(const std::vector<rec2vector> &v): vertices(v) {}
+    polygon(const rec2vector *v, std::size_t n): vertices(v, v + n) {}
+
+    std::size_t size(void)  const {return vertices.size();}
+    bool        empty(void) const {return vertices.empty();}
+
+    /*
+     * Return the area, positive if the vertices are anticlockwise, negative if clockwise.
+     */
+    double area(void) const;
+
+    /*
+     * Return the smallest rect containing the polygon (zero size if empty).
+     */
+    rect bounds(void) const;
+
+    std::vector<rec2vector> vertices;
+ };
+
+ /*
+  * Polygons stored one after another in a single array of vertices, polygon i being
+  * vertices[offset[i], offset[i + 1]).  offset always starts with 0, so there is one more
+  * offset than there are polygons.  Clearing keeps the capacity of both arrays, so a batch
+  * that is cleared and refilled allocates nothing once it has grown to its working size.
+  */
+ class polygonBatch
+ {
+  public:
+    polygonBatch(void): offset(1, 0) {}
+
+    std::size_t size(void)  const {return offset.size() - 1;}
+    bool        empty(void) const {return offset.size() == 1;}
+
+    std::size_t size(std::size_t i) const {return offset[i + 1] - offset[i];}
+
+    const rec2vector *operator[](std::size_t i) const {return vertices.data() + offset[i];}
+
+    void clear(void) {vertices.clear(); offset.resize(1);}
+
+    void reserve(std::size_t polygons, std::size_t vertexCount)
+    {
+       offset.reserve(polygons + 1); vertices.reserve(vertexCount);
+    }
+
+    void append(const rec2vector *v, std::size_t n)
+    {
+       vertices.insert(vertices.end(), v, v + n); offset.push_back(vertices.size());
+    }
+
+    void append(const polygon &p) {append(p.vertices.data(), p.size());}
+
+    polygon get(std::size_t i) const {return polygon((*this)[i], size(i));}
+
+    std::vector<rec2vector>  vertices;
+    std::vector<std::size_t> offset;
+ };
+
+ /*
+  * Edges of a polygon prepared for point-in-polygon tests.
+  *
+  * A point p is inside if a ray from p in the +x direction crosses an odd number of edges.
+  * Edge i, from its lower to its upper end, is held as the line x = m[i] (y - yLow[i]) + x0[i]
+  * (representation XeqMyPlusC, with the division done once here), and is crossed if
+  * yLow[i] <= p.y < yHigh[i] and p is left of that line.  Horizontal edges are dropped.
+  *
+  * The half-open range in y means that a point on an edge shared by two polygons of a
+  * tiling is inside exactly one of them.  Points on other boundaries may be either.
+  */
+ class polygonEdges
+ {
+  public:
+    polygonEdges(void) {box.l = box.r = box.b = box.t = 0;}
+    explicit polygonEdges(const polygon &p) {assign(p);}
+
+    void assign(const polygon &);
+
+    std::size_t size(void) const {return x0.size();}
+
+    bool contains(rec2vector p) const;
+
+    rect        box; // bounds of the polygon
+    doubleArray yLow, yHigh, x0, m;
+ };
+
+}
+
+// GLOBAL FUNCTION DECLARATIONS ///////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ /*
+  * Return the convex hull of the n points at v, anticlockwise from the leftmost (lowest) point,
+  * without collinear vertices (Andrew's monotone chain, with the robust orient()).
+  * Using 'threads' threads (0 = one per core, if n is large enough), each thread finds the
+  * hull of a contiguous part of the points, and the hull of their vertices is returned.
+  * Fewer than three distinct points give a hull of those points.
+  */
+ polygon convexHull(const rec2vector *v, std::size_t n, unsigned threads = 0);
+
+ /*
+  * Set the bits of 'inside' for the points inside the polygon of 'edges' (see polygonEdges),
+  * using 'threads' threads (0 = one per core, if there are enough points).  Return the number
+  * of points inside.
+  *
+  * Each pack of points outside the bounds of the polygon is skipped, so for many points
+  * against many small polygons, points sorted along a curve (see curve_order.h) are faster.
+  */
+ std::size_t classify(const rec2vectorBatch &points, const polygonEdges &edges,
+                      pointMask &inside, unsigned threads = 0                  );
+
+}
+
+#endif
+
+/*****************************************END*OF*FILE*********************************************/
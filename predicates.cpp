@@ -0,0 +1,280 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "predicates.cpp" -                                                                              *
+*                                                                                                 *
+*           Author - Tom McDonnell 2026                                                           *
+*                                                                                                 *
+\*************************************************************************************************/
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "predicates.h"
+
+#include <cassert>
+#include <cmath>
+
+// LOCAL FUNCTION DEFINITIONS /////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ // Expansion arithmetic.
+ // An expansion is an array of doubles, in increasing order of magnitude and with no two
+ // overlapping in their significant bits, whose exact sum is the value represented.  Zero
+ // components are eliminated, except that zero is represented by a single zero.  The last
+ // component approximates the value, and has its sign.
+
+ const double splitter = 134217729.0; // 2^27 + 1
+
+ /*
+  * x + y = a + b exactly, with x = fl(a + b).
+  */
+ static void twoSum(double a, double b, double &x, double &y)
+ {
+    x = a + b;
+
+    double bv = x - a, av = x - bv;
+
+    y = (a - av) + (b - bv);
+ }
+
+ /*
+  * As twoSum(), given |a| >= |b|.
+  */
+ static void fastTwoSum(double a, double b, double &x, double &y)
+ {
+    x = a + b;
+    y = b - (x - a);
+ }
+
+#ifndef __FMA__
+ /*
+  * Split a into high and low halves of 26 significant bits each (Dekker).
+  * Only needed where twoProduct() has no fused multiply-add.
+  */
+ static void split(double a, double &high, double &low)
+ {
+    double c = splitter * a;
+
+    high = c - (c - a);
+    low  = a - high;
+ }
+#endif
+
+ /*
+  * x + y = a * b exactly, with x = fl(a * b).
+  * Where there is a fused multiply-add instruction, it gives y directly.  Otherwise (and so
+  * where the compiler cannot contract the split into a fused multiply-add) the product of the
+  * halves of a and b is summed exactly (Dekker).
+  */
+ static void twoProduct(double a, double b, double &x, double &y)
+ {
+    x = a * b;
+
+#ifdef __FMA__
+    y = std::fma(a, b, -x);
+#else
+    double aHigh, aLow, bHigh, bLow;
+
+    split(a, aHigh, aLow);
+    split(b, bHigh, bLow);
+    y = aLow * bLow - (((x - aHigh * bHigh) - aLow * bHigh) - aHigh * bLow);
+#endif
+ }
+
+ /*
+  * Set h to the expansion of a - b.  Return its length.
+  */
+ static int difference(double a, double b, double *h)
+ {
+    double x, y;
+
+    twoSum(a, -b, x, y);
+
+    int n = 0;
+
+    if (y != 0) h[n++] = y;
+    h[n++] = x;
+
+    return n;
+ }
+
+ /*
+  * Set h (of length up to ne + nf) to the sum of expansions e and f.  Return its length.
+  * The components of both are merged in order of magnitude, then accumulated.
+  */
+ static int sum(const double *e, int ne, const double *f, int nf, double *h)
+ {
+    int    i = 0, j = 0, n = 0;
+    double q, s, t;
+
+    auto next = [&](void)
+    {
+       if (j == nf || (i < ne && std::fabs(e[i]) < std::fabs(f[j]))) return e[i++];
+       return f[j++];
+    };
+
+    q = next();
+
+    while (i < ne || j < nf)
+    {
+       twoSum(q, next(), s, t);
+
+       if (t != 0) h[n++] = t;
+       q = s;
+    }
+
+    if (q != 0 || n == 0) h[n++] = q;
+
+    return n;
+ }
+
+ /*
+  * Set h (of length up to 2 ne) to expansion e times b.  Return its length.
+  */
+ static int scale(const double *e, int ne, double b, double *h)
+ {
+    double q, t, product1, product0, s;
+    int    n = 0;
+
+    twoProduct(e[0], b, q, t);
+
+    if (t != 0) h[n++] = t;
+
+    for (int i = 1; i < ne; ++i)
+    {
+       twoProduct(e[i], b, product1, product0);
+       twoSum(q, product0, s, t);
+
+       if (t != 0) h[n++] = t;
+
+       fastTwoSum(product1, s, q, t);
+
+       if (t != 0) h[n++] = t;
+    }
+
+    if (q != 0 || n == 0) h[n++] = q;
+
+    return n;
+ }
+
+ /*
+  * Set h (of length up to 2 ne nf, which must be no more than 512) to the product of
+  * expansions e and f.  Return its length.
+  */
+ static int product(const double *e, int ne, const double *f, int nf, double *h)
+ {
+    double scaled[512], acc[512];
+    int    n = 1;
+
+    assert(2 * ne * nf <= 512);
+
+    h[0] = 0;
+
+    for (int j = 0; j < nf; ++j)
+    {
+       int m = scale(e, ne, f[j], scaled);
+
+       for (int k = 0; k < n; ++k)
+         acc[k] = h[k];
+
+       n = sum(acc, n, scaled, m, h);
+    }
+
+    return n;
+ }
+
+ /*
+  * Set h to the expansion of a * b - c * d for expansions a, b, c and d of length up to 2.
+  * Return its length (up to 16).
+  */
+ static int crossTerm(const double *a, int na, const double *b, int nb,
+                      const double *c, int nc, const double *d, int nd, double *h)
+ {
+    double ab[8], cd[8];
+    int    nab = product(a, na, b, nb, ab),
+           ncd = product(c, nc, d, nd, cd);
+
+    for (int k = 0; k < ncd; ++k)
+      cd[k] = -cd[k];
+
+    return sum(ab, nab, cd, ncd, h);
+ }
+
+} // end namespace TomsLibGeometry
+
+// GLOBAL FUNCTION DEFINITIONS ////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ /*
+  * The differences of coordinates are usually exact (as for nearby points), in which case
+  * only the two products need be expanded.
+  */
+ double orientExact(rec2vector a, rec2vector b, rec2vector c, rec2vector d)
+ {
+    double abx[2], aby[2], cdx[2], cdy[2], det[16];
+    int    nabx = difference(b.x, a.x, abx), naby = difference(b.y, a.y, aby),
+           ncdx = difference(d.x, c.x, cdx), ncdy = difference(d.y, c.y, cdy), n;
+
+    if (nabx == 1 && naby == 1 && ncdx == 1 && ncdy == 1)
+    {
+       double left[2], right[2];
+       int    nLeft  = scale(abx, 1, cdy[0], left),
+              nRight = scale(aby, 1, cdx[0], right);
+
+       for (int k = 0; k < nRight; ++k)
+         right[k] = -right[k];
+
+       n = sum(left, nLeft, right, nRight, det);
+    }
+    else
+      n = crossTerm(abx, nabx, cdy, ncdy, aby, naby, cdx, ncdx, det);
+
+    return det[n - 1];
+ }
+
+ double inCircleExact(rec2vector a, rec2vector b, rec2vector c, rec2vector d)
+ {
+    double adx[2], ady[2], bdx[2], bdy[2], cdx[2], cdy[2];
+    int    nadx = difference(a.x, d.x, adx), nady = difference(a.y, d.y, ady),
+           nbdx = difference(b.x, d.x, bdx), nbdy = difference(b.y, d.y, bdy),
+           ncdx = difference(c.x, d.x, cdx), ncdy = difference(c.y, d.y, cdy);
+
+    double bc[16], ca[16], ab[16];
+    int    nbc = crossTerm(bdx, nbdx, cdy, ncdy, cdx, ncdx, bdy, nbdy, bc),
+           nca = crossTerm(cdx, ncdx, ady, nady, adx, nadx, cdy, ncdy, ca),
+           nab = crossTerm(adx, nadx, bdy, nbdy, bdx, nbdx, ady, nady, ab);
+
+    double aLift[16], bLift[16], cLift[16], squares[2][8];
+    int    nLift[3];
+
+    // a, b, c lifts: dx^2 + dy^2
+    {
+       const double *x[3]  = {adx, bdx, cdx}, *y[3] = {ady, bdy, cdy};
+       const int     nx[3] = {nadx, nbdx, ncdx}, ny[3] = {nady, nbdy, ncdy};
+       double       *lift[3] = {aLift, bLift, cLift};
+
+       for (int k = 0; k < 3; ++k)
+       {
+          int n0 = product(x[k], nx[k], x[k], nx[k], squares[0]),
+              n1 = product(y[k], ny[k], y[k], ny[k], squares[1]);
+
+          nLift[k] = sum(squares[0], n0, squares[1], n1, lift[k]);
+       }
+    }
+
+    double terms[3][512], partial[1024], det[1536];
+    int    nt0 = product(aLift, nLift[0], bc, nbc, terms[0]),
+           nt1 = product(bLift, nLift[1], ca, nca, terms[1]),
+           nt2 = product(cLift, nLift[2], ab, nab, terms[2]),
+           np  = sum(terms[0], nt0, terms[1], nt1, partial),
+           n   = sum(partial, np, terms[2], nt2, det);
+
+    return det[n - 1];
+ }
+
+} // end namespace TomsLibGeometry
+
+/*****************************************END*OF*FILE*********************************************/
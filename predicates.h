@@ -0,0 +1,120 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "predicates.h" - Robust orientation, in-circle and parallel predicates on                       *
+*                  rec2vector, filtered with an exact fallback.                                   *
+*                                                                                                 *
+*         Author - Tom McDonnell 2026                                                             *
+*                                                                                                 *
+\*************************************************************************************************/
+
+#ifndef TOMS_LIB_PREDICATES_H
+#define TOMS_LIB_PREDICATES_H
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "geometry.h"
+
+#include <cmath>
+
+// GLOBAL CONSTANTS ///////////////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ // Relative error bounds of the floating point evaluations of the determinants (Shewchuk,
+ // "Adaptive Precision Floating-Point Arithmetic and Fast Robust Geometric Predicates").
+ // If the computed determinant is larger in magnitude than the bound times the permanent
+ // (the sum of the magnitudes of its terms), its sign is correct.
+
+ const double predicateEpsilon   = 1.1102230246251565e-16; // 2^-53
+ const double orientErrorBound   = (3.0 + 16.0 * predicateEpsilon) * predicateEpsilon;
+ const double inCircleErrorBound = (10.0 + 96.0 * predicateEpsilon) * predicateEpsilon;
+
+}
+
+// GLOBAL FUNCTION DECLARATIONS ///////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ // Exact versions of the predicates below, used when the floating point filter fails.
+ // Each returns a value of the sign of the exact determinant.
+
+ double orientExact(rec2vector a, rec2vector b, rec2vector c, rec2vector d);
+ double inCircleExact(rec2vector a, rec2vector b, rec2vector c, rec2vector d);
+
+}
+
+// GLOBAL INLINE FUNCTION DEFINITIONS /////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ // Each predicate first evaluates its determinant in floating point, and returns that if it
+ // is far enough from zero for its sign to be certain.  Otherwise the sign is found exactly
+ // (by expansion arithmetic), so that the result is correct and consistent for any inputs.
+ // Results other than the sign are approximate.  Inputs must be finite and not so large or
+ // small that the determinant over or underflows.
+
+ /*
+  * Return > 0 if direction c -> d is anticlockwise from direction a -> b (the cross product
+  * (b - a) x (d - c) is positive), < 0 if clockwise, 0 if the directions are parallel.
+  */
+ inline double orient(rec2vector a, rec2vector b, rec2vector c, rec2vector d)
+ {
+    double left  = (b.x - a.x) * (d.y - c.y),
+           right = (b.y - a.y) * (d.x - c.x),
+           det   = left - right,
+           bound = orientErrorBound * (std::fabs(left) + std::fabs(right));
+
+    if (std::fabs(det) > bound) return det;
+
+    return orientExact(a, b, c, d);
+ }
+
+ /*
+  * Return > 0 if a, b, c are in anticlockwise order (c is left of a -> b), < 0 if clockwise,
+  * 0 if collinear.  The value approximates twice the signed area of triangle abc.
+  */
+ inline double orient(rec2vector a, rec2vector b, rec2vector c) {return orient(a, b, a, c);}
+
+ /*
+  * Return true if direction a -> b is parallel (or antiparallel) to direction c -> d.
+  */
+ inline bool parallel(rec2vector a, rec2vector b, rec2vector c, rec2vector d)
+ {
+    return orient(a, b, c, d) == 0;
+ }
+
+ /*
+  * For a, b, c in anticlockwise order, return > 0 if d is inside the circle through a, b and
+  * c, < 0 if outside, 0 if on it.  The sign is reversed if a, b, c are clockwise.
+  */
+ inline double inCircle(rec2vector a, rec2vector b, rec2vector c, rec2vector d)
+ {
+    double adx = a.x - d.x, ady = a.y - d.y,
+           bdx = b.x - d.x, bdy = b.y - d.y,
+           cdx = c.x - d.x, cdy = c.y - d.y,
+
+           bdxcdy = bdx * cdy, cdxbdy = cdx * bdy, aLift = adx * adx + ady * ady,
+           cdxady = cdx * ady, adxcdy = adx * cdy, bLift = bdx * bdx + bdy * bdy,
+           adxbdy = adx * bdy, bdxady = bdx * ady, cLift = cdx * cdx + cdy * cdy,
+
+           det = aLift * (bdxcdy - cdxbdy) + bLift * (cdxady - adxcdy) + cLift * (adxbdy - bdxady),
+
+           permanent = (std::fabs(bdxcdy) + std::fabs(cdxbdy)) * aLift
+                     + (std::fabs(cdxady) + std::fabs(adxcdy)) * bLift
+                     + (std::fabs(adxbdy) + std::fabs(bdxady)) * cLift,
+
+           bound = inCircleErrorBound * permanent;
+
+    if (std::fabs(det) > bound) return det;
+
+    return inCircleExact(a, b, c, d);
+ }
+
+}
+
+#endif
+
+/*****************************************END*OF*FILE*********************************************/
@@ -0,0 +1,287 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "ray_cast.cpp" -                                                                                *
+*                                                                                                 *
+*         Author - Tom McDonnell 2026                                                             *
+*                                                                                                 *
+\*************************************************************************************************/
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "ray_cast.h"
+#include "parallel.h"
+
+#include <algorithm>
+
+#include <cassert>
+#include <cmath>
+
+// LOCAL FUNCTION DEFINITIONS /////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+ using TomsLibParallel::parallelFor;
+
+ /*
+  * Fraction of a cell by which segments are widened when listed in cells, so that rounding
+  * cannot leave a segment out of a cell it touches.
+  */
+ const double cellMargin = 1e-9;
+
+ static double cross(rec2vector u, rec2vector v) {return u.x * v.y - u.y * v.x;}
+ static double dot(rec2vector u, rec2vector v)   {return u.x * v.x + u.y * v.y;}
+
+} // end namespace TomsLibGeometry
+
+// STATIC MEMBER CONSTANT DEFINITIONS /////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ const std::size_t rayCaster::none;
+
+}
+
+// MEMBER FUNCTION DEFINITIONS ////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ void rayCaster::clear(void)
+ {
+    a.clear();
+    b.clear();
+    start.assign(2, 0);
+    list.clear();
+    bounds.l = bounds.r = bounds.b = bounds.t = 0;
+    nx = ny = 1;
+    cellW = cellH = 1;
+ }
+
+ /*
+  * The grid has about n cells, shaped to the bounds of the segments.  Each segment is listed
+  * in the cells it passes through, found row by row from the part of the segment within the
+  * row, counted in one pass and written in a second.
+  */
+ void rayCaster::build(const rec2vector *p1, const rec2vector *p2, std::size_t n)
+ {
+    assert(n < 0xffffffff);
+
+    clear();
+
+    if (n == 0) return;
+
+    a.assign(p1, p1 + n);
+    b.assign(p2, p2 + n);
+
+    bounds.l = bounds.r = a[0].x;
+    bounds.b = bounds.t = a[0].y;
+
+    for (std::size_t s = 0; s < n; ++s)
+    {
+       bounds.l = std::min(bounds.l, std::min(a[s].x, b[s].x));
+       bounds.r = std::max(bounds.r, std::max(a[s].x, b[s].x));
+       bounds.b = std::min(bounds.b, std::min(a[s].y, b[s].y));
+       bounds.t = std::max(bounds.t, std::max(a[s].y, b[s].y));
+    }
+
+    double w = bounds.r - bounds.l, h = bounds.t - bounds.b, cells = double(n);
+
+    if (w > 0 && h > 0)
+    {
+       nx = int(std::min(std::ceil(std::sqrt(cells * w / h)), cells));
+       ny = int(std::min(std::ceil(std::sqrt(cells * h / w)), cells));
+    }
+    else
+    {
+       nx = (w > 0)? int(n): 1;
+       ny = (h > 0)? int(n): 1;
+    }
+
+    cellW = (w > 0)? w / nx: 1;
+    cellH = (h > 0)? h / ny: 1;
+
+    auto eachCell = [&](std::uint32_t s, auto f)
+    {
+       rec2vector p = a[s], q = b[s];
+       double     yLo = std::min(p.y, q.y), yHi = std::max(p.y, q.y),
+                  mx  = cellMargin * cellW, my = cellMargin * cellH;
+
+       for (int r = row(yLo - my), r1 = row(yHi + my); r <= r1; ++r)
+       {
+          double y0 = std::min(std::max(yLo, bounds.b + r * cellH), yHi),
+                 y1 = std::max(std::min(yHi, bounds.b + (r + 1) * cellH), yLo),
+                 x0 = std::min(p.x, q.x), x1 = std::max(p.x, q.x);
+
+          if (p.y != q.y)
+          {
+             double m = (q.x - p.x) / (q.y - p.y);
+
+             x0 = p.x + (y0 - p.y) * m;
+             x1 = p.x + (y1 - p.y) * m;
+
+             if (x0 > x1) std::swap(x0, x1);
+          }
+
+          for (int c = column(x0 - mx), c1 = column(x1 + mx); c <= c1; ++c)
+            f(std::size_t(r) * nx + c);
+       }
+    };
+
+    start.assign(std::size_t(nx) * ny + 1, 0);
+
+    for (std::uint32_t s = 0; s < n; ++s)
+      eachCell(s, [&](std::size_t c) {++start[c + 1];});
+
+    for (std::size_t c = 1; c < start.size(); ++c)
+      start[c] += start[c - 1];
+
+    std::vector<std::size_t> next(start.begin(), start.end() - 1);
+
+    list.resize(start.back());
+
+    for (std::uint32_t s = 0; s < n; ++s)
+      eachCell(s, [&](std::size_t c) {list[next[c]++] = s;});
+ }
+
+ int rayCaster::column(double x) const
+ {
+    double c = std::floor((x - bounds.l) / cellW);
+
+    return (c < 0)? 0: (c >= nx)? nx - 1: int(c);
+ }
+
+ int rayCaster::row(double y) const
+ {
+    double r = std::floor((y - bounds.b) / cellH);
+
+    return (r < 0)? 0: (r >= ny)? ny - 1: int(r);
+ }
+
+ /*
+  * If the ray o + t d meets segment s at 0 <= t <= maxT and nearer than 'best' (or as near,
+  * with a lower index), replace 'best' and return true.
+  */
+ bool rayCaster::hitSegment(std::uint32_t s, rec2vector o, rec2vector d, double maxT,
+                            rayHit &best                                            ) const
+ {
+    rec2vector e = b[s] - a[s], w = a[s] - o;
+    double     den = cross(d, e), sn = cross(w, d), t;
+
+    if (den != 0)
+    {
+       double u = sn / den;
+
+       t = cross(w, e) / den;
+
+       if (!(t >= 0 && u >= 0 && u <= 1)) return false;
+    }
+    else
+    {
+       double dd = dot(d, d);
+
+       if (sn != 0 || dd == 0) return false; // parallel, or no direction
+
+       double t0 = dot(w, d) / dd, t1 = dot(b[s] - o, d) / dd;
+
+       if (t0 > t1) std::swap(t0, t1);
+       if (t1 < 0) return false;
+
+       t = std::max(t0, 0.0);
+    }
+
+    if (t > maxT || t > best.t || (t == best.t && s >= best.segment)) return false;
+
+    best.t       = t;
+    best.p       = o + d * t;
+    best.segment = s;
+
+    return true;
+ }
+
+ /*
+  * The ray is first clipped to the (closed) bounds of the grid.  tNextX and tNextY are the
+  * values of t at which it leaves the current cell through its x and y sides.
+  */
+ rayHit rayCaster::cast(rec2vector o, rec2vector d, double maxT) const
+ {
+    const double inf = std::numeric_limits<double>::infinity(),
+                 nan = std::numeric_limits<double>::quiet_NaN();
+    rayHit       best = {inf, rec2vector(nan, nan), none};
+    double       t0 = 0, t1 = maxT;
+
+    if (empty()) return best;
+
+    // clip to the bounds
+    const double lo[2] = {bounds.l, bounds.b}, hi[2] = {bounds.r, bounds.t},
+                 os[2] = {o.x, o.y},           ds[2] = {d.x, d.y};
+
+    for (int k = 0; k < 2; ++k)
+    {
+       if (ds[k] == 0)
+       {
+          if (os[k] < lo[k] || os[k] > hi[k]) return best;
+       }
+       else
+       {
+          double ta = (lo[k] - os[k]) / ds[k], tb = (hi[k] - os[k]) / ds[k];
+
+          t0 = std::max(t0, std::min(ta, tb));
+          t1 = std::min(t1, std::max(ta, tb));
+       }
+    }
+
+    if (t0 > t1) return best;
+
+    // walk the cells
+    rec2vector s = o + d * t0;
+    int        cx = column(s.x), cy = row(s.y),
+               stepX = (d.x > 0)? 1: -1, stepY = (d.y > 0)? 1: -1;
+    double     tNextX = (d.x == 0)? inf: (bounds.l + (cx + (d.x > 0)) * cellW - o.x) / d.x,
+               tNextY = (d.y == 0)? inf: (bounds.b + (cy + (d.y > 0)) * cellH - o.y) / d.y,
+               tStepX = (d.x == 0)? inf: cellW / std::fabs(d.x),
+               tStepY = (d.y == 0)? inf: cellH / std::fabs(d.y);
+
+    for (;;)
+    {
+       std::size_t c = std::size_t(cy) * nx + cx;
+
+       for (std::size_t k = start[c]; k < start[c + 1]; ++k)
+         hitSegment(list[k], o, d, maxT, best);
+
+       double tExit = std::min(tNextX, tNextY);
+
+       if (best.t <= tExit || tExit > t1) break;
+
+       if (tNextX < tNextY)
+       {
+          cx += stepX;
+          if (cx < 0 || cx >= nx) break;
+          tNextX += tStepX;
+       }
+       else
+       {
+          cy += stepY;
+          if (cy < 0 || cy >= ny) break;
+          tNextY += tStepY;
+       }
+    }
+
+    return best;
+ }
+
+ void rayCaster::cast(const rec2vector *origins, const rec2vector *directions, std::size_t n,
+                      std::vector<rayHit> &hits, unsigned threads, double maxT) const
+ {
+    hits.resize(n);
+
+    parallelFor(n, threads, [&](std::size_t begin, std::size_t end, unsigned)
+    {
+       for (std::size_t i = begin; i < end; ++i)
+         hits[i] = cast(origins[i], directions[i], maxT);
+    });
+ }
+
+} // end namespace TomsLibGeometry
+
+/*****************************************END*OF*FILE*********************************************/
@@ -0,0 +1,99 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "ray_cast.h" - Ray casting against a large fixed set of line segments, through                  *
+*                a uniform grid traversed by DDA.                                                 *
+*                                                                                                 *
+*       Author - Tom McDonnell 2026                                                               *
+*                                                                                                 *
+\*************************************************************************************************/
+
+#ifndef TOMS_LIB_RAY_CAST_H
+#define TOMS_LIB_RAY_CAST_H
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "geometry.h"
+#include "vector.h"
+
+#include <limits>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+// GLOBAL TYPE DEFINITIONS ////////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ /*
+  * Nearest point where a ray origin + t direction (t >= 0) meets a segment.  If there is no
+  * such point, segment = rayCaster::none, t is infinite and p is NaN.
+  */
+ struct rayHit
+ {
+    double      t;
+    rec2vector  p;
+    std::size_t segment; // index of the segment hit
+ };
+
+ /*
+  * Uniform grid over a set of segments, built once and then cast against by any number of
+  * rays (from any number of threads at once).
+  *
+  * The grid has about as many cells as there are segments, laid over their bounds, and each
+  * cell lists the segments that pass through it (conservatively, so a segment on a cell
+  * boundary is listed in both cells).  A ray visits the cells it passes through in order
+  * (by DDA), testing the segments of each, and stops at the first cell containing the
+  * nearest hit found so far.
+  */
+ class rayCaster
+ {
+  public:
+    static const std::size_t none = std::size_t(-1);
+
+    rayCaster(void) {clear();}
+    rayCaster(const rec2vector *p1, const rec2vector *p2, std::size_t n) {build(p1, p2, n);}
+
+    /*
+     * (Re)build the grid over the n segments p1[i] -> p2[i].  n must be less than 2^32.
+     */
+    void build(const rec2vector *p1, const rec2vector *p2, std::size_t n);
+
+    std::size_t size(void)  const {return a.size();}
+    bool        empty(void) const {return a.empty();}
+
+    /*
+     * Return the nearest hit of the ray origin + t direction, 0 <= t <= maxT.
+     * Segments collinear with the ray are hit at their nearest point to the origin.
+     */
+    rayHit cast(rec2vector origin, rec2vector direction,
+                double maxT = std::numeric_limits<double>::infinity()) const;
+
+    /*
+     * hits[i] = cast(origins[i], directions[i], maxT) for each of n rays, using 'threads'
+     * threads (0 = one per core, if there are enough rays).  'hits' is resized to n.
+     */
+    void cast(const rec2vector *origins, const rec2vector *directions, std::size_t n,
+              std::vector<rayHit> &hits, unsigned threads = 0,
+              double maxT = std::numeric_limits<double>::infinity()                 ) const;
+
+  private:
+    void clear(void);
+    int  column(double x) const;
+    int  row(double y) const;
+    bool hitSegment(std::uint32_t s, rec2vector o, rec2vector d, double maxT, rayHit &best) const;
+
+    std::vector<rec2vector>    a, b;     // segments
+    rect                       bounds;   // of the grid
+    int                        nx, ny;   // cells in x and y
+    double                     cellW, cellH;
+    std::vector<std::size_t>   start;    // segments of cell c are list[start[c], start[c + 1])
+    std::vector<std::uint32_t> list;
+ };
+
+}
+
+#endif
+
+/*****************************************END*OF*FILE*********************************************/
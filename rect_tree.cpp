@@ -0,0 +1,261 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "rect_tree.cpp" -                                                                               *
+*                                                                                                 *
+*          Author - Tom McDonnell 2026                                                            *
+*                                                                                                 *
+\*************************************************************************************************/
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "rect_tree.h"
+#include "parallel.h"
+
+#include <math.h>
+
+#include <algorithm>
+#include <limits>
+
+#include <cassert>
+
+// LOCAL FUNCTION DEFINITIONS /////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+ using TomsLibParallel::parallelFor;
+ using TomsLibParallel::parallelTasks;
+ using TomsLibSimd::packd;
+ using TomsLibSimd::broadcast;
+ using TomsLibSimd::load;
+
+ /*
+  * A rect or node to be packed into a node of the next level up.
+  */
+ struct packEntry
+ {
+    rect          box;
+    std::uint32_t id;
+    double        cx, cy; // centre of box
+ };
+
+ static packEntry makeEntry(const rect &box, std::uint32_t id)
+ {
+    packEntry e = {box, id, (box.l + box.r) / 2, (box.b + box.t) / 2};
+
+    return e;
+ }
+
+ /*
+  * Return a mask with bit k set if the interior of child k of the node overlaps q.
+  * Unused children have empty (inverted infinite) bounds, so never overlap.
+  */
+ template<class node>
+ static unsigned overlapMask(const node &nd, const rect &q)
+ {
+    packd    ql = broadcast(q.l), qr = broadcast(q.r),
+             qb = broadcast(q.b), qt = broadcast(q.t);
+    unsigned bits = 0;
+
+    for (int k = 0; k < rectTree::fanout; k += packd::width)
+    {
+       packd m =   cmplt(load(nd.l + k), qr) & cmplt(ql, load(nd.r + k))
+                 & cmplt(load(nd.b + k), qt) & cmplt(qb, load(nd.t + k));
+
+       bits |= unsigned(movemask(m)) << k;
+    }
+
+    return bits;
+ }
+
+ /*
+  * Squared distance from p to the nearest point of rect r (0 if p is inside r).
+  */
+ static double squaredDistance(rec2vector p, double l, double r, double b, double t)
+ {
+    double dx = std::max(std::max(l - p.x, p.x - r), 0.0),
+           dy = std::max(std::max(b - p.y, p.y - t), 0.0);
+
+    return dx * dx + dy * dy;
+ }
+
+} // end namespace TomsLibGeometry
+
+// MEMBER FUNCTION DEFINITIONS ////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ /*
+  * Sort-Tile-Recursive: the entries of a level are sorted by x centre and cut into
+  * about sqrt(number of nodes) vertical slices of whole nodes, and each slice is sorted by
+  * y centre and cut into nodes.  Slices are packed in parallel, each into its own range of
+  * nodes.  The nodes become the entries of the next level up, until one node remains.
+  */
+ void rectTree::build(const rect *r, std::size_t n, unsigned threads)
+ {
+    const double           inf = std::numeric_limits<double>::infinity();
+    std::vector<packEntry> entries(n);
+    bool                   leaf = true;
+
+    assert(n < 0xffffffff);
+
+    nodes.clear();
+    root  = 0;
+    count = n;
+
+    if (n == 0) return;
+
+    parallelFor(n, threads, [&](std::size_t begin, std::size_t end, unsigned)
+    {
+       for (std::size_t i = begin; i < end; ++i)
+         entries[i] = makeEntry(r[i], std::uint32_t(i));
+    });
+
+    do
+    {
+       std::size_t m        = entries.size(),
+                   nNodes   = (m + fanout - 1) / fanout,
+                   perSlice = std::size_t(ceil(sqrt(double(nNodes)))) * fanout,
+                   nSlices  = (m + perSlice - 1) / perSlice,
+                   base     = nodes.size();
+
+       std::sort(entries.begin(), entries.end(),
+                 [](const packEntry &a, const packEntry &b) {return a.cx < b.cx;});
+
+       nodes.resize(base + nNodes);
+
+       parallelTasks(nSlices, threads, [&](std::size_t s)
+       {
+          std::size_t first = s * perSlice,
+                      last  = std::min(first + perSlice, m);
+
+          std::sort(entries.begin() + first, entries.begin() + last,
+                    [](const packEntry &a, const packEntry &b) {return a.cy < b.cy;});
+
+          for (std::size_t i = first; i < last; i += fanout)
+          {
+             node &nd = nodes[base + i / fanout];
+
+             nd.count = std::uint32_t(std::min(std::size_t(fanout), last - i));
+             nd.leaf  = leaf;
+
+             for (int k = 0; k < fanout; ++k)
+               if (std::uint32_t(k) < nd.count)
+               {
+                  const packEntry &e = entries[i + k];
+
+                  nd.l[k] = e.box.l; nd.r[k] = e.box.r;
+                  nd.b[k] = e.box.b; nd.t[k] = e.box.t;
+                  nd.child[k] = e.id;
+               }
+               else
+               {
+                  nd.l[k] = nd.b[k] =  inf;
+                  nd.r[k] = nd.t[k] = -inf;
+                  nd.child[k] = 0;
+               }
+          }
+       });
+
+       entries.resize(nNodes);
+
+       for (std::size_t i = 0; i < nNodes; ++i)
+       {
+          const node &nd  = nodes[base + i];
+          rect        box = {nd.l[0], nd.r[0], nd.t[0], nd.b[0]};
+
+          for (std::uint32_t k = 1; k < nd.count; ++k)
+          {
+             box.l = std::min(box.l, nd.l[k]); box.r = std::max(box.r, nd.r[k]);
+             box.b = std::min(box.b, nd.b[k]); box.t = std::max(box.t, nd.t[k]);
+          }
+
+          entries[i] = makeEntry(box, std::uint32_t(base + i));
+       }
+
+       leaf = false;
+    }
+    while (entries.size() > 1);
+
+    root = entries[0].id;
+ }
+
+ void rectTree::stab(rec2vector p, std::vector<std::size_t> &out) const
+ {
+    // insideRect(p, r) is overlap() of r with the degenerate rect at p
+    rect q = {p.x, p.x, p.y, p.y};
+
+    overlapping(q, out);
+ }
+
+ void rectTree::overlapping(const rect &q, std::vector<std::size_t> &out) const
+ {
+    std::uint32_t stack[16 * fanout]; // depth is at most 11 levels for 2^32 rects
+    int           top = 0;
+
+    if (empty()) return;
+
+    stack[top++] = root;
+
+    while (top > 0)
+    {
+       const node &nd   = nodes[stack[--top]];
+       unsigned    bits = overlapMask(nd, q);
+
+       for (; bits != 0; bits &= bits - 1)
+       {
+          int k = __builtin_ctz(bits);
+
+          if (nd.leaf) out.push_back(nd.child[k]);
+          else         stack[top++] = nd.child[k];
+       }
+    }
+ }
+
+ /*
+  * Best first search: nodes and rects are visited in order of distance from p, so the first
+  * rect taken from the queue is the nearest.
+  */
+ std::size_t rectTree::nearest(rec2vector p) const
+ {
+    struct queued
+    {
+       double        d2;
+       std::uint32_t id;
+       bool          isRect;
+
+       bool operator<(const queued &q) const {return d2 > q.d2;} // for a min-heap
+    };
+
+    std::vector<queued> heap;
+    queued              start = {0.0, root, false};
+
+    assert(!empty());
+
+    heap.reserve(4 * fanout);
+    heap.push_back(start);
+
+    for (;;)
+    {
+       std::pop_heap(heap.begin(), heap.end());
+       queued q = heap.back();
+       heap.pop_back();
+
+       if (q.isRect) return q.id;
+
+       const node &nd = nodes[q.id];
+
+       for (std::uint32_t k = 0; k < nd.count; ++k)
+       {
+          queued c = {squaredDistance(p, nd.l[k], nd.r[k], nd.b[k], nd.t[k]),
+                      nd.child[k], nd.leaf != 0                            };
+
+          heap.push_back(c);
+          std::push_heap(heap.begin(), heap.end());
+       }
+    }
+ }
+
+} // end namespace TomsLibGeometry
+
+/*****************************************END*OF*FILE*********************************************/
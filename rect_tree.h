@@ -0,0 +1,92 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "rect_tree.h" - Bulk loaded R-tree over a set of rects, for point stabbing,                     *
+*                 overlap and nearest rect queries.                                               *
+*                                                                                                 *
+*        Author - Tom McDonnell 2026                                                              *
+*                                                                                                 *
+\*************************************************************************************************/
+
+#ifndef TOMS_LIB_RECT_TREE_H
+#define TOMS_LIB_RECT_TREE_H
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "geometry.h"
+#include "simd.h"
+#include "vector.h"
+
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+// GLOBAL TYPE DEFINITIONS ////////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ /*
+  * R-tree built once over an array of rects by Sort-Tile-Recursive packing, so that every
+  * node except the last of each level is full.
+  *
+  * Each node holds the bounds of up to 'fanout' children as separate aligned arrays of
+  * l, r, b and t, so that a node is a whole number of cache lines and all of its children
+  * are tested against a query with a few SIMD comparisons.
+  *
+  * Queries report rects by their indices in the array the tree was built from.
+  * A built tree is not modified by queries, so any number of threads may query it at once.
+  */
+ class rectTree
+ {
+  public:
+    static const int fanout = 8;
+
+    rectTree(void): root(0), count(0) {}
+    rectTree(const rect *r, std::size_t n, unsigned threads = 0) {build(r, n, threads);}
+
+    /*
+     * (Re)build the tree over the n rects at r, using 'threads' threads (0 = one per core).
+     * n must be less than 2^32.
+     */
+    void build(const rect *r, std::size_t n, unsigned threads = 0);
+
+    std::size_t size(void)  const {return count;}
+    bool        empty(void) const {return count == 0;}
+
+    /*
+     * Append to 'out' the indices of the rects r for which insideRect(p, r).
+     */
+    void stab(rec2vector p, std::vector<std::size_t> &out) const;
+
+    /*
+     * Append to 'out' the indices of the rects r for which overlap(q, r).
+     */
+    void overlapping(const rect &q, std::vector<std::size_t> &out) const;
+
+    /*
+     * Return the index of the rect nearest p (at distance 0 if p is inside or on it).
+     * The tree must not be empty.
+     */
+    std::size_t nearest(rec2vector p) const;
+
+  private:
+    struct alignas(TomsLibSimd::alignment) node
+    {
+       double        l[fanout], r[fanout], b[fanout], t[fanout]; // bounds of children
+       std::uint32_t child[fanout]; // index of child node, or of rect if leaf
+       std::uint32_t count;         // number of children
+       std::uint32_t leaf;          // 1 if children are rects
+    };
+
+    std::vector<node, TomsLibSimd::alignedAllocator<node> > nodes;
+
+    std::uint32_t root;
+    std::size_t   count;
+ };
+
+} // end namespace TomsLibGeometry
+
+#endif
+
+/*****************************************END*OF*FILE*********************************************/
@@ -0,0 +1,260 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "reduce.cpp" -                                                                                  *
+*                                                                                                 *
+*       Author - Tom McDonnell 2026                                                               *
+*                                                                                                 *
+\*************************************************************************************************/
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "reduce.h"
+#include "parallel.h"
+
+#include <vector>
+
+#include <cassert>
+
+// LOCAL FUNCTION DEFINITIONS /////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+ using TomsLibParallel::padded;
+ using TomsLibParallel::parallelFor;
+ using TomsLibParallel::threadCount;
+
+ // component access, so that 2D and 3D reductions share code
+
+ template<class V> struct dimsOf;
+ template<>        struct dimsOf<rec2vector> {static const int value = 2;};
+ template<>        struct dimsOf<rec3vector> {static const int value = 3;};
+
+ static double component(const rec2vector &v, int d) {return (d == 0)? v.x: v.y;}
+ static double component(const rec3vector &v, int d) {return (d == 0)? v.x: (d == 1)? v.y: v.z;}
+
+ static double squaredMagnitude(const rec2vector &v) {return v.x * v.x + v.y * v.y;}
+ static double squaredMagnitude(const rec3vector &v) {return v.x * v.x + v.y * v.y + v.z * v.z;}
+
+ /*
+  * mean[d] = mean of component d of the n vectors at v.
+  */
+ template<class V>
+ static void componentMeans(const V *v, std::size_t n, unsigned threads, double (&mean)[3])
+ {
+    const int                               dims = dimsOf<V>::value;
+    std::vector<padded<compensatedSum[3]> > partial(threadCount(n, threads));
+
+    assert(n > 0);
+
+    parallelFor(n, threads, [&](std::size_t begin, std::size_t end, unsigned t)
+    {
+       compensatedSum sum[3];
+
+       for (std::size_t i = begin; i < end; ++i)
+         for (int d = 0; d < dims; ++d)
+           sum[d].add(component(v[i], d));
+
+       for (int d = 0; d < dims; ++d)
+         partial[t].value[d] = sum[d];
+    });
+
+    for (int d = 0; d < dims; ++d)
+    {
+       compensatedSum total;
+
+       for (std::size_t t = 0; t < partial.size(); ++t)
+         total.add(partial[t].value[d]);
+
+       mean[d] = total.value() / double(n);
+    }
+ }
+
+ /*
+  * lo[d], hi[d] = least and greatest component d of the n vectors at v.
+  */
+ template<class V>
+ static void componentBounds(const V *v, std::size_t n, unsigned threads,
+                             double (&lo)[3], double (&hi)[3]            )
+ {
+    struct bounds {double lo[3], hi[3];};
+
+    const int                    dims = dimsOf<V>::value;
+    std::vector<padded<bounds> > partial(threadCount(n, threads));
+
+    assert(n > 0);
+
+    parallelFor(n, threads, [&](std::size_t begin, std::size_t end, unsigned t)
+    {
+       bounds b;
+
+       for (int d = 0; d < dims; ++d)
+         b.lo[d] = b.hi[d] = component(v[begin], d);
+
+       for (std::size_t i = begin + 1; i < end; ++i)
+         for (int d = 0; d < dims; ++d)
+         {
+            double c = component(v[i], d);
+
+            if (c < b.lo[d]) b.lo[d] = c;
+            if (c > b.hi[d]) b.hi[d] = c;
+         }
+
+       partial[t].value = b;
+    });
+
+    for (int d = 0; d < dims; ++d)
+    {
+       lo[d] = partial[0].value.lo[d];
+       hi[d] = partial[0].value.hi[d];
+
+       for (std::size_t t = 1; t < partial.size(); ++t)
+       {
+          if (partial[t].value.lo[d] < lo[d]) lo[d] = partial[t].value.lo[d];
+          if (partial[t].value.hi[d] > hi[d]) hi[d] = partial[t].value.hi[d];
+       }
+    }
+ }
+
+ template<class V>
+ static double magnitudeSum(const V *v, std::size_t n, unsigned threads)
+ {
+    std::vector<padded<compensatedSum> > partial(threadCount(n, threads));
+
+    parallelFor(n, threads, [&](std::size_t begin, std::size_t end, unsigned t)
+    {
+       compensatedSum sum;
+
+       for (std::size_t i = begin; i < end; ++i)
+         sum.add(sqrt(squaredMagnitude(v[i])));
+
+       partial[t].value = sum;
+    });
+
+    compensatedSum total;
+
+    for (std::size_t t = 0; t < partial.size(); ++t)
+      total.add(partial[t].value);
+
+    return total.value();
+ }
+
+ template<class V>
+ static void squaredDistanceRange(const V *v, std::size_t n, V p, unsigned threads,
+                                  double &min, double &max                         )
+ {
+    struct range {double min, max;};
+
+    std::vector<padded<range> > partial(threadCount(n, threads));
+
+    assert(n > 0);
+
+    parallelFor(n, threads, [&](std::size_t begin, std::size_t end, unsigned t)
+    {
+       range r;
+
+       r.min = r.max = squaredMagnitude(v[begin] - p);
+
+       for (std::size_t i = begin + 1; i < end; ++i)
+       {
+          double d = squaredMagnitude(v[i] - p);
+
+          if (d < r.min) r.min = d;
+          if (d > r.max) r.max = d;
+       }
+
+       partial[t].value = r;
+    });
+
+    min = partial[0].value.min;
+    max = partial[0].value.max;
+
+    for (std::size_t t = 1; t < partial.size(); ++t)
+    {
+       if (partial[t].value.min < min) min = partial[t].value.min;
+       if (partial[t].value.max > max) max = partial[t].value.max;
+    }
+ }
+
+} // end namespace TomsLibGeometry
+
+// GLOBAL FUNCTION DEFINITIONS ////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ rec2vector centroid(const rec2vector *v, std::size_t n, unsigned threads)
+ {
+    double mean[3];
+
+    componentMeans(v, n, threads, mean);
+
+    return rec2vector(mean[0], mean[1]);
+ }
+
+ rec3vector centroid(const rec3vector *v, std::size_t n, unsigned threads)
+ {
+    double mean[3];
+
+    componentMeans(v, n, threads, mean);
+
+    return rec3vector(mean[0], mean[1], mean[2]);
+ }
+
+ rect boundingRect(const rec2vector *v, std::size_t n, unsigned threads)
+ {
+    double lo[3], hi[3];
+    rect   r;
+
+    componentBounds(v, n, threads, lo, hi);
+
+    r.l = lo[0]; r.r = hi[0];
+    r.b = lo[1]; r.t = hi[1];
+
+    return r;
+ }
+
+ box boundingBox(const rec3vector *v, std::size_t n, unsigned threads)
+ {
+    double lo[3], hi[3];
+    box    b;
+
+    componentBounds(v, n, threads, lo, hi);
+
+    b.l = lo[0]; b.r = hi[0];
+    b.b = lo[1]; b.t = hi[1];
+    b.n = lo[2]; b.f = hi[2];
+
+    return b;
+ }
+
+ double sumOfMagnitudes(const rec2vector *v, std::size_t n, unsigned threads)
+ {
+    return magnitudeSum(v, n, threads);
+ }
+
+ double sumOfMagnitudes(const rec3vector *v, std::size_t n, unsigned threads)
+ {
+    return magnitudeSum(v, n, threads);
+ }
+
+ void distanceRange(const rec2vector *v, std::size_t n, rec2vector p,
+                    double &min, double &max, unsigned threads       )
+ {
+    squaredDistanceRange(v, n, p, threads, min, max);
+
+    min = sqrt(min);
+    max = sqrt(max);
+ }
+
+ void distanceRange(const rec3vector *v, std::size_t n, rec3vector p,
+                    double &min, double &max, unsigned threads       )
+ {
+    squaredDistanceRange(v, n, p, threads, min, max);
+
+    min = sqrt(min);
+    max = sqrt(max);
+ }
+
+} // end namespace TomsLibGeometry
+
+/*****************************************END*OF*FILE*********************************************/
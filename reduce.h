@@ -0,0 +1,87 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "reduce.h" - Multi-threaded reductions (centroid, bounds, sums of                               *
+*              magnitudes, distance ranges) over large arrays of vectors.                         *
+*                                                                                                 *
+*     Author - Tom McDonnell 2026                                                                 *
+*                                                                                                 *
+\*************************************************************************************************/
+
+#ifndef TOMS_LIB_REDUCE_H
+#define TOMS_LIB_REDUCE_H
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "geometry.h"
+#include "vector.h"
+
+#include <math.h>
+
+#include <cstddef>
+
+// GLOBAL TYPE DEFINITIONS ////////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ /*
+  * Sum of doubles with compensation for rounding error (Neumaier's variant of Kahan
+  * summation).  The error of the result does not grow with the number of terms.
+  */
+ class compensatedSum
+ {
+  public:
+    compensatedSum(void): sum(0), c(0) {}
+
+    void add(double x)
+    {
+       double t = sum + x;
+
+       if (fabs(sum) >= fabs(x)) c += (sum - t) + x;
+       else                      c += (x - t) + sum;
+
+       sum = t;
+    }
+
+    void add(const compensatedSum &s) {add(s.sum); add(s.c);}
+
+    double value(void) const {return sum + c;}
+
+  private:
+    double sum, c; // c = running compensation for lost low-order bits
+ };
+
+}
+
+// GLOBAL FUNCTION DECLARATIONS ///////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ // Reductions over the n vectors at v.
+ // Work is split across 'threads' threads (0 = one per core), each accumulating its own
+ // partial result, and partial results are combined in a fixed order, so results do not
+ // depend on thread timing.  Sums are compensated.  n must be at least 1.
+
+ rec2vector centroid(const rec2vector *v, std::size_t n, unsigned threads = 0);
+ rec3vector centroid(const rec3vector *v, std::size_t n, unsigned threads = 0);
+
+ rect boundingRect(const rec2vector *v, std::size_t n, unsigned threads = 0);
+ box  boundingBox(const rec3vector *v, std::size_t n, unsigned threads = 0);
+
+ double sumOfMagnitudes(const rec2vector *v, std::size_t n, unsigned threads = 0);
+ double sumOfMagnitudes(const rec3vector *v, std::size_t n, unsigned threads = 0);
+
+ /*
+  * Find the least and greatest distance from p to any of the vectors.
+  */
+ void distanceRange(const rec2vector *v, std::size_t n, rec2vector p,
+                    double &min, double &max, unsigned threads = 0   );
+ void distanceRange(const rec3vector *v, std::size_t n, rec3vector p,
+                    double &min, double &max, unsigned threads = 0   );
+
+} // end namespace TomsLibGeometry
+
+#endif
+
+/*****************************************END*OF*FILE*********************************************/
@@ -0,0 +1,556 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "segment_sweep.cpp" -                                                                           *
+*                                                                                                 *
+*              Author - Tom McDonnell 2026                                                        *
+*                                                                                                 *
+\*************************************************************************************************/
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "segment_sweep.h"
+#include "parallel.h"
+#include "predicates.h"
+
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <set>
+
+#include <cassert>
+#include <cstdint>
+
+// LOCAL TYPE DEFINITIONS /////////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ /*
+  * Segment with its ends ordered so that p is left of q (or below q if vertical).
+  */
+ struct sweepSegment
+ {
+    rec2vector  p, q;
+    std::size_t id;   // index of the segment in the caller's arrays
+ };
+
+ /*
+  * Bentley-Ottmann sweep from left to right over a set of segments, reporting pairs that
+  * have a point in common.
+  *
+  * The status holds the non-vertical segments crossing the sweep line, ordered by height.
+  * Pairs are reported:
+  *  - when two segments that cross at a point interior to both become neighbours in the
+  *    status (a crossing event then swaps them at the crossing point),
+  *  - at each end point P of a non-vertical segment, between all the segments through P
+  *    (so touching and overlapping collinear segments are found),
+  *  - for each vertical or zero length segment, against every segment within its y range,
+  *    and against other vertical segments at the same x.
+  *
+  * At each x, vertical segments are processed first, then points in order of y.  At an end
+  * point P, segments ending at P are removed and the segments through P are put in their
+  * order just right of P before those starting at P are inserted, so that the status stays
+  * ordered however many segments meet there.  The sweep stops after the last x <= xStop.
+  *
+  * Orientations are found with the robust predicates, so which pairs meet, and the order of
+  * segments through a common point, are decided exactly.  Only crossing points are rounded
+  * (from exactly evaluated cross products), and are kept no later than the ends of their
+  * segments.  A swap may still be made on the wrong side of an event a rounding error away,
+  * which for segments crossing at a vanishingly small angle can hide a pair.
+  */
+ class segmentSweep
+ {
+  public:
+    segmentSweep(const std::vector<sweepSegment> &segs, double xStop,
+                 std::vector<indexPair> &out                         );
+
+    void run(void);
+
+  private:
+    struct entry
+    {
+       mutable std::uint32_t s; // changed in place when neighbours swap at a crossing
+    };
+
+    /*
+     * Order of the status.  Only ever compares an entry with the key (the segment being
+     * inserted, or the point being searched for).
+     */
+    struct order
+    {
+       const segmentSweep *sweep;
+
+       bool operator()(const entry &a, const entry &b) const
+       {
+          if (a.s == sweep->key) return sweep->compareToKey(b.s) > 0;
+          if (b.s == sweep->key) return sweep->compareToKey(a.s) < 0;
+          return a.s < b.s;
+       }
+    };
+
+    typedef std::set<entry, order> statusTree;
+    typedef statusTree::iterator   position;
+
+    struct crossing
+    {
+       double        x, y;
+       std::uint32_t a, b; // a below b before the crossing
+
+       bool operator<(const crossing &c) const {return x > c.x || (x == c.x && y > c.y);}
+    };
+
+    static const std::uint32_t pointKey = 0xffffffff;
+
+    int  compareToKey(std::uint32_t t) const;
+    bool directionLess(std::uint32_t t, std::uint32_t u) const;
+    void test(position lower, position upper);
+    void swapAt(const crossing &c);
+    void processPoint(rec2vector p, std::size_t startsBegin, std::size_t startsEnd);
+    void scanVerticals(std::size_t begin, std::size_t end, std::size_t startsBegin,
+                       std::size_t startsEnd                                       );
+    void report(std::uint32_t a, std::uint32_t b);
+
+    const std::vector<sweepSegment> &segs;
+    std::vector<indexPair>          &out;
+    double                           xStop, sweepX;
+
+    std::vector<std::uint32_t> starts, ends, verticals; // in order of processing
+    statusTree                 status;
+    std::vector<position>      where;  // position of each active segment in the status
+    std::vector<char>          active; // 1 while a segment is in the status
+
+    std::priority_queue<crossing> crossings;
+
+    std::uint32_t key;      // segment being inserted, or pointKey
+    rec2vector    keyPoint; // left end of the segment being inserted, or point searched for
+
+    std::vector<std::uint32_t> group;     // used by processPoint()
+    std::vector<position>      positions; // "
+ };
+
+} // end namespace TomsLibGeometry
+
+// LOCAL FUNCTION DEFINITIONS /////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+ using TomsLibParallel::parallelTasks;
+ using TomsLibParallel::threadCount;
+
+ static bool samePoint(rec2vector a, rec2vector b) {return a.x == b.x && a.y == b.y;}
+
+ /*
+  * orient(s.p, s.q, p), without the exact evaluation for the common case of p an end of s.
+  */
+ static double side(const sweepSegment &s, rec2vector p)
+ {
+    return (samePoint(p, s.p) || samePoint(p, s.q))? 0.0: orient(s.p, s.q, p);
+ }
+
+ static bool through(const sweepSegment &s, rec2vector p) {return side(s, p) == 0;}
+
+ static bool lexLess(rec2vector a, rec2vector b) {return a.x < b.x || (a.x == b.x && a.y < b.y);}
+
+ static bool oppositeSigns(double a, double b) {return (a > 0 && b < 0) || (a < 0 && b > 0);}
+
+ /*
+  * Append the pairs found by sweeping 'segs' up to xStop to 'out'.
+  */
+ static void sweep(const std::vector<sweepSegment> &segs, double xStop,
+                   std::vector<indexPair> &out                         )
+ {
+    segmentSweep s(segs, xStop, out);
+
+    s.run();
+ }
+
+ /*
+  * Sort pairs and remove duplicates.
+  */
+ static void sortPairs(std::vector<indexPair> &pairs)
+ {
+    std::sort(pairs.begin(), pairs.end());
+    pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+ }
+
+} // end namespace TomsLibGeometry
+
+// MEMBER FUNCTION DEFINITIONS ////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ const std::uint32_t segmentSweep::pointKey;
+
+ segmentSweep::segmentSweep(const std::vector<sweepSegment> &segs1, double xStop1,
+                            std::vector<indexPair> &out1                          )
+ : segs(segs1), out(out1), xStop(xStop1), sweepX(0), status(order{this}),
+   where(segs1.size()), active(segs1.size(), 0), key(pointKey)
+ {
+    assert(segs.size() < pointKey);
+
+    for (std::uint32_t s = 0; s < segs.size(); ++s)
+      if (segs[s].p.x == segs[s].q.x) verticals.push_back(s);
+      else                            {starts.push_back(s); ends.push_back(s);}
+
+    std::sort(starts.begin(), starts.end(), [&](std::uint32_t a, std::uint32_t b)
+    {
+       return lexLess(segs[a].p, segs[b].p);
+    });
+
+    std::sort(ends.begin(), ends.end(), [&](std::uint32_t a, std::uint32_t b)
+    {
+       return lexLess(segs[a].q, segs[b].q);
+    });
+
+    std::sort(verticals.begin(), verticals.end(), [&](std::uint32_t a, std::uint32_t b)
+    {
+       return lexLess(segs[a].p, segs[b].p);
+    });
+ }
+
+ void segmentSweep::run(void)
+ {
+    const double inf = std::numeric_limits<double>::infinity();
+    std::size_t  si = 0, ei = 0, vi = 0;
+
+    for (;;)
+    {
+       double x = inf;
+
+       if (si < starts.size())    x = std::min(x, segs[starts[si]].p.x);
+       if (ei < ends.size())      x = std::min(x, segs[ends[ei]].q.x);
+       if (vi < verticals.size()) x = std::min(x, segs[verticals[vi]].p.x);
+       if (!crossings.empty())    x = std::min(x, crossings.top().x);
+
+       if (x == inf || x > xStop) break;
+
+       sweepX = x;
+
+       std::size_t sx = si, v0 = vi;
+
+       while (sx < starts.size() && segs[starts[sx]].p.x == x)
+         ++sx;
+
+       while (vi < verticals.size() && segs[verticals[vi]].p.x == x)
+         ++vi;
+
+       // crossings scheduled at x before it was reached, so that the status is ordered at x
+       while (!crossings.empty() && crossings.top().x == x)
+       {
+          crossing c = crossings.top();
+          crossings.pop();
+          swapAt(c);
+       }
+
+       scanVerticals(v0, vi, si, sx);
+
+       // points at x, in order of y
+       for (;;)
+       {
+          double ys = (si < sx)? segs[starts[si]].p.y: inf,
+                 ye = (ei < ends.size()   && segs[ends[ei]].q.x   == x)? segs[ends[ei]].q.y: inf,
+                 yc = (!crossings.empty() && crossings.top().x    == x)? crossings.top().y:  inf,
+                 y  = std::min(std::min(ys, ye), yc);
+
+          if (y == inf) break;
+
+          if (yc == y)
+          {
+             crossing c = crossings.top();
+             crossings.pop();
+             swapAt(c);
+             continue;
+          }
+
+          rec2vector  p(x, y);
+          std::size_t s0 = si;
+
+          while (si < sx && samePoint(segs[starts[si]].p, p))
+            ++si;
+
+          while (ei < ends.size() && samePoint(segs[ends[ei]].q, p))
+            ++ei;
+
+          processPoint(p, s0, si);
+       }
+    }
+ }
+
+ /*
+  * Return < 0 if segment t is below the key, > 0 if above.  For a segment key, segments
+  * through its left end are ordered by direction (their order just right of the end), then
+  * by index.  For a point key, 0 is returned for segments through the point.
+  */
+ int segmentSweep::compareToKey(std::uint32_t t) const
+ {
+    double o = side(segs[t], keyPoint);
+
+    if (o > 0) return -1;
+    if (o < 0) return  1;
+
+    if (key == pointKey) return 0;
+
+    return directionLess(t, key)? -1: 1;
+ }
+
+ /*
+  * Order of segments through a common point just right of it.
+  */
+ bool segmentSweep::directionLess(std::uint32_t t, std::uint32_t u) const
+ {
+    double c = orient(segs[t].p, segs[t].q, segs[u].p, segs[u].q);
+
+    return c > 0 || (c == 0 && t < u);
+ }
+
+ /*
+  * Test neighbours 'lower' and 'upper' (in that order in the status).  If they cross at a
+  * point interior to both, report them, and if the lower is the steeper (so that they have
+  * yet to cross), schedule their swap at the crossing point.
+  */
+ void segmentSweep::test(position lower, position upper)
+ {
+    std::uint32_t       a = lower->s, b = upper->s;
+    const sweepSegment &A = segs[a], &B = segs[b];
+
+    if (   !oppositeSigns(orient(A.p, A.q, B.p), orient(A.p, A.q, B.q))
+        || !oppositeSigns(orient(B.p, B.q, A.p), orient(B.p, B.q, A.q))) return;
+
+    report(a, b);
+
+    if (orient(A.p, A.q, B.p, B.q) < 0)
+    {
+       // cross products evaluated exactly, as the crossing is ill-conditioned if near parallel
+       double     t   = orientExact(A.p, B.p, B.p, B.q) / orientExact(A.p, A.q, B.p, B.q);
+       rec2vector x   = A.p + (A.q - A.p) * std::min(std::max(t, 0.0), 1.0),
+                  end = lexLess(A.q, B.q)? A.q: B.q;
+
+       // keep the rounded point no later than either end, so that the swap is not left
+       // until after a segment has ended
+       if (lexLess(end, x)) x = end;
+
+       crossing c = {std::max(x.x, sweepX), x.y, a, b};
+
+       crossings.push(c);
+    }
+ }
+
+ /*
+  * Swap the segments of a crossing if they are still neighbours in the order they were
+  * scheduled in (otherwise the event is stale), and test their new neighbours.
+  */
+ void segmentSweep::swapAt(const crossing &c)
+ {
+    if (!active[c.a] || !active[c.b]) return;
+
+    position i = where[c.a], j = where[c.b];
+
+    if (std::next(i) != j) return;
+
+    i->s = c.b; where[c.b] = i;
+    j->s = c.a; where[c.a] = j;
+
+    if (i != status.begin()) test(std::prev(i), i);
+    if (std::next(j) != status.end()) test(j, std::next(j));
+ }
+
+ /*
+  * Process end point p, where starts[startsBegin, startsEnd) start.  Report every pair
+  * among the segments through p, remove those ending at p, reorder the rest as just right
+  * of p, insert those starting at p, then test the segments through p against their new
+  * neighbours.
+  */
+ void segmentSweep::processPoint(rec2vector p, std::size_t startsBegin, std::size_t startsEnd)
+ {
+    entry e = {pointKey};
+
+    key      = pointKey;
+    keyPoint = p;
+    group.clear();
+    positions.clear();
+
+    position i = status.lower_bound(e);
+
+    for (; i != status.end() && through(segs[i->s], p); ++i)
+      group.push_back(i->s);
+
+    for (std::size_t k = startsBegin; k < startsEnd; ++k)
+      group.push_back(starts[k]);
+
+    for (std::size_t j = 0; j < group.size(); ++j)
+      for (std::size_t k = j + 1; k < group.size(); ++k)
+        report(group[j], group[k]);
+
+    // remove segments ending at p, keeping the positions of the rest
+    group.clear();
+
+    for (i = status.lower_bound(e); i != status.end() && through(segs[i->s], p);)
+    {
+       std::uint32_t t = i->s;
+
+       if (samePoint(segs[t].q, p))
+       {
+          active[t] = 0;
+          i = status.erase(i);
+       }
+       else
+       {
+          group.push_back(t);
+          positions.push_back(i++);
+       }
+    }
+
+    std::sort(group.begin(), group.end(), [this](std::uint32_t t, std::uint32_t u)
+    {
+       return directionLess(t, u);
+    });
+
+    for (std::size_t k = 0; k < group.size(); ++k)
+    {
+       positions[k]->s = group[k];
+       where[group[k]] = positions[k];
+    }
+
+    for (std::size_t k = startsBegin; k < startsEnd; ++k)
+    {
+       std::uint32_t s = starts[k];
+       entry         f = {s};
+
+       key       = s;
+       keyPoint  = p;
+       where[s]  = status.insert(f).first;
+       active[s] = 1;
+    }
+
+    key      = pointKey;
+    keyPoint = p;
+
+    position first = status.lower_bound(e), last = first;
+
+    while (last != status.end() && through(segs[last->s], p))
+      ++last;
+
+    if (first != status.begin() && first != status.end()) test(std::prev(first), first);
+    if (last != first && last != status.end()) test(std::prev(last), last);
+ }
+
+ /*
+  * Report the vertical segments verticals[begin, end) (all at the same x, in order of lower
+  * end) against the segments in the status within their y ranges, the segments
+  * starts[startsBegin, startsEnd) starting at that x within their y ranges, and each other.
+  */
+ void segmentSweep::scanVerticals(std::size_t begin, std::size_t end, std::size_t startsBegin,
+                                  std::size_t startsEnd                                       )
+ {
+    entry e = {pointKey};
+
+    key = pointKey;
+
+    for (std::size_t k = begin; k < end; ++k)
+    {
+       const sweepSegment &v = segs[verticals[k]];
+
+       keyPoint = v.p;
+
+       for (position i = status.lower_bound(e);
+            i != status.end() && orient(segs[i->s].p, segs[i->s].q, v.q) >= 0; ++i)
+         report(verticals[k], i->s);
+
+       std::size_t j = std::lower_bound(starts.begin() + startsBegin, starts.begin() + startsEnd,
+                                        v.p.y, [this](std::uint32_t t, double y)
+                                        {
+                                           return segs[t].p.y < y;
+                                        }                                               )
+                       - starts.begin();
+
+       for (; j < startsEnd && segs[starts[j]].p.y <= v.q.y; ++j)
+         report(verticals[k], starts[j]);
+
+       for (std::size_t j = k + 1; j < end && segs[verticals[j]].p.y <= v.q.y; ++j)
+         report(verticals[k], verticals[j]);
+    }
+ }
+
+ void segmentSweep::report(std::uint32_t a, std::uint32_t b)
+ {
+    std::size_t i = segs[a].id, j = segs[b].id;
+
+    out.push_back((i < j)? indexPair(i, j): indexPair(j, i));
+ }
+
+} // end namespace TomsLibGeometry
+
+// GLOBAL FUNCTION DEFINITIONS ////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ /*
+  * In strip mode, strip k covers [bound[k], bound[k + 1]] and sweeps every segment reaching
+  * into it, from the segments' left ends, stopping at bound[k + 1].  Each pair meeting at a
+  * point in the strip is then found by that strip's sweep exactly as by a sweep of all the
+  * segments.  Pairs found by more than one strip are removed when the results are merged.
+  */
+ void segmentIntersections(const rec2vector *p1, const rec2vector *p2, std::size_t n,
+                           std::vector<indexPair> &pairs, unsigned threads            )
+ {
+    const double              inf = std::numeric_limits<double>::infinity();
+    std::vector<sweepSegment> segs(n);
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+       bool         inOrder = !lexLess(p2[i], p1[i]);
+       sweepSegment s       = {inOrder? p1[i]: p2[i], inOrder? p2[i]: p1[i], i};
+
+       segs[i] = s;
+    }
+
+    pairs.clear();
+
+    unsigned count = threadCount(n, threads);
+
+    if (count == 1)
+    {
+       sweep(segs, inf, pairs);
+       sortPairs(pairs);
+       return;
+    }
+
+    std::size_t         strips = 2 * std::size_t(count);
+    std::vector<double> left(n), bound(strips + 1);
+
+    for (std::size_t i = 0; i < n; ++i)
+      left[i] = segs[i].p.x;
+
+    std::sort(left.begin(), left.end());
+
+    bound[0]      = -inf;
+    bound[strips] =  inf;
+
+    for (std::size_t k = 1; k < strips; ++k)
+      bound[k] = left[n * k / strips];
+
+    std::vector<std::vector<indexPair> > found(strips);
+
+    parallelTasks(strips, threads, [&](std::size_t k)
+    {
+       std::vector<sweepSegment> strip;
+
+       for (std::size_t i = 0; i < n; ++i)
+         if (segs[i].p.x <= bound[k + 1] && segs[i].q.x >= bound[k])
+           strip.push_back(segs[i]);
+
+       sweep(strip, bound[k + 1], found[k]);
+       sortPairs(found[k]);
+    });
+
+    for (std::size_t k = 0; k < strips; ++k)
+      pairs.insert(pairs.end(), found[k].begin(), found[k].end());
+
+    sortPairs(pairs);
+ }
+
+} // end namespace TomsLibGeometry
+
+/*****************************************END*OF*FILE*********************************************/
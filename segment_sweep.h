@@ -0,0 +1,55 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "segment_sweep.h" - All intersecting pairs among a set of line segments, by a                   *
+*                     Bentley-Ottmann sweep, optionally split into parallel strips.               *
+*                                                                                                 *
+*            Author - Tom McDonnell 2026                                                          *
+*                                                                                                 *
+\*************************************************************************************************/
+
+#ifndef TOMS_LIB_SEGMENT_SWEEP_H
+#define TOMS_LIB_SEGMENT_SWEEP_H
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "geometry.h"
+#include "vector.h"
+
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+// GLOBAL TYPE DEFINITIONS ////////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ typedef std::pair<std::size_t, std::size_t> indexPair;
+
+}
+
+// GLOBAL FUNCTION DECLARATIONS ///////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ /*
+  * Set 'pairs' to the pairs (i, j), i < j, of segments p1[i] -> p2[i] and p1[j] -> p2[j] that
+  * have at least one point in common, in ascending order.  This includes segments that cross,
+  * that touch (at an end or a T junction), and collinear segments that overlap.
+  * Vertical and zero length segments are allowed.
+  *
+  * Time is O((n + k) log n) for k pairs.  If more than one thread is used ('threads', 0 = one
+  * per core, and n large enough), the plane is cut into vertical strips of about equal numbers
+  * of segments and each strip is swept on its own thread, sweeping only the segments that
+  * reach into it.
+  */
+ void segmentIntersections(const rec2vector *p1, const rec2vector *p2, std::size_t n,
+                           std::vector<indexPair> &pairs, unsigned threads = 0       );
+
+}
+
+#endif
+
+/*****************************************END*OF*FILE*********************************************/
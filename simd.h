@@ -0,0 +1,334 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "simd.h" - Thin wrapper over the SIMD instruction set available at                              *
+*            compile time (AVX, SSE2, or plain scalar code), plus an                              *
+*            aligned allocator for the arrays the kernels work on.                                *
+*                                                                                                 *
+*   Author - Tom McDonnell 2026                                                                   *
+*                                                                                                 *
+\*************************************************************************************************/
+
+#ifndef TOMS_LIB_SIMD_H
+#define TOMS_LIB_SIMD_H
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include <new>
+
+#include <cstddef>
+#include <cstdlib>
+#include <cmath>
+
+#if defined(__AVX__)
+#  include <immintrin.h>
+#  define TOMS_LIB_SIMD_AVX
+#elif defined(__SSE2__)
+#  include <emmintrin.h>
+#  define TOMS_LIB_SIMD_SSE2
+#endif
+
+// GLOBAL CONSTANTS ///////////////////////////////////////////////////////////////////////////////
+
+namespace TomsLibSimd
+{
+
+ /*
+  * Alignment (in bytes) of arrays allocated through alignedAllocator.
+  * One cache line, which is also enough for any AVX load.
+  */
+ const std::size_t alignment = 64;
+
+}
+
+// GLOBAL TYPE DEFINITIONS ////////////////////////////////////////////////////////////////////////
+
+namespace TomsLibSimd
+{
+
+ /*
+  * Allocator returning 'alignment' aligned storage, so that std::vector can be used
+  * for the arrays handed to the SIMD kernels.
+  */
+ template<class T>
+ class alignedAllocator
+ {
+  public:
+    typedef T value_type;
+
+    template<class U> struct rebind {typedef alignedAllocator<U> other;};
+
+    alignedAllocator(void) {}
+    template<class U> alignedAllocator(const alignedAllocator<U> &) {}
+
+    T *allocate(std::size_t n)
+    {
+       std::size_t bytes = (n * sizeof(T) + alignment - 1) / alignment * alignment;
+       void       *p     = std::aligned_alloc(alignment, (bytes == 0)? alignment: bytes);
+
+       if (p == 0)
+         throw std::bad_alloc();
+
+       return static_cast<T *>(p);
+    }
+
+    void deallocate(T *p, std::size_t) {std::free(p);}
+ };
+
+ template<class T, class U>
+ inline bool operator==(const alignedAllocator<T> &, const alignedAllocator<U> &) {return true;}
+
+ template<class T, class U>
+ inline bool operator!=(const alignedAllocator<T> &, const alignedAllocator<U> &) {return false;}
+
+ /*
+  * Aligned array of doubles.
+  */
+ typedef std::vector<double, alignedAllocator<double> > doubleArray;
+
+ /*
+  * Pack of 'packd::width' doubles processed by a single instruction.
+  * Masks returned by the comparison functions are packs with all bits of a lane set (true)
+  * or clear (false), suitable for select() and movemask().
+  * fma(a, b, c) is a * b + c, rounded once where the target has fused multiply-add.  Code
+  * that must round the same wherever it is inlined uses it rather than leaving the choice of
+  * which products to fuse to the compiler.
+  */
+#if defined(TOMS_LIB_SIMD_AVX)
+
+ struct packd
+ {
+    static const int width = 4;
+
+    packd(void) {}
+    packd(__m256d v1): v(v1) {}
+
+    __m256d v;
+ };
+
+#elif defined(TOMS_LIB_SIMD_SSE2)
+
+ struct packd
+ {
+    static const int width = 2;
+
+    packd(void) {}
+    packd(__m128d v1): v(v1) {}
+
+    __m128d v;
+ };
+
+#else
+
+ struct packd
+ {
+    static const int width = 1;
+
+    packd(void) {}
+    packd(double v1): v(v1) {}
+
+    double v;
+ };
+
+#endif
+
+} // end namespace TomsLibSimd
+
+// GLOBAL INLINE FUNCTION DEFINITIONS /////////////////////////////////////////////////////////////
+
+namespace TomsLibSimd
+{
+
+#if defined(TOMS_LIB_SIMD_AVX)
+
+ inline packd broadcast(double d)        {return _mm256_set1_pd(d);}
+ inline packd load(const double *p)      {return _mm256_load_pd(p);}
+ inline packd loadu(const double *p)     {return _mm256_loadu_pd(p);}
+ inline void  store(double *p, packd a)  {_mm256_store_pd(p, a.v);}
+ inline void  storeu(double *p, packd a) {_mm256_storeu_pd(p, a.v);}
+
+ inline packd operator+(packd a, packd b) {return _mm256_add_pd(a.v, b.v);}
+ inline packd operator-(packd a, packd b) {return _mm256_sub_pd(a.v, b.v);}
+ inline packd operator*(packd a, packd b) {return _mm256_mul_pd(a.v, b.v);}
+ inline packd operator/(packd a, packd b) {return _mm256_div_pd(a.v, b.v);}
+ inline packd operator-(packd a)          {return _mm256_xor_pd(a.v, _mm256_set1_pd(-0.0));}
+
+ inline packd sqrt(packd a)         {return _mm256_sqrt_pd(a.v);}
+ inline packd floor(packd a)        {return _mm256_floor_pd(a.v);}
+ inline packd abs(packd a)          {return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a.v);}
+ inline packd min(packd a, packd b) {return _mm256_min_pd(a.v, b.v);}
+ inline packd max(packd a, packd b) {return _mm256_max_pd(a.v, b.v);}
+
+#ifdef __FMA__
+ inline packd fma(packd a, packd b, packd c) {return _mm256_fmadd_pd(a.v, b.v, c.v);}
+#else
+ inline packd fma(packd a, packd b, packd c) {return a * b + c;}
+#endif
+
+ inline packd cmplt(packd a, packd b) {return _mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ);}
+ inline packd cmple(packd a, packd b) {return _mm256_cmp_pd(a.v, b.v, _CMP_LE_OQ);}
+ inline packd cmpgt(packd a, packd b) {return _mm256_cmp_pd(a.v, b.v, _CMP_GT_OQ);}
+ inline packd cmpge(packd a, packd b) {return _mm256_cmp_pd(a.v, b.v, _CMP_GE_OQ);}
+ inline packd cmpeq(packd a, packd b) {return _mm256_cmp_pd(a.v, b.v, _CMP_EQ_OQ);}
+
+ inline packd operator&(packd a, packd b) {return _mm256_and_pd(a.v, b.v);}
+ inline packd operator|(packd a, packd b) {return _mm256_or_pd(a.v, b.v);}
+ inline packd operator^(packd a, packd b) {return _mm256_xor_pd(a.v, b.v);}
+ inline packd andnot(packd a, packd b)    {return _mm256_andnot_pd(a.v, b.v);} // ~a & b
+
+ inline packd select(packd mask, packd a, packd b) {return _mm256_blendv_pd(b.v, a.v, mask.v);}
+ inline int   movemask(packd mask)                 {return _mm256_movemask_pd(mask.v);}
+
+#elif defined(TOMS_LIB_SIMD_SSE2)
+
+ inline packd broadcast(double d)        {return _mm_set1_pd(d);}
+ inline packd load(const double *p)      {return _mm_load_pd(p);}
+ inline packd loadu(const double *p)     {return _mm_loadu_pd(p);}
+ inline void  store(double *p, packd a)  {_mm_store_pd(p, a.v);}
+ inline void  storeu(double *p, packd a) {_mm_storeu_pd(p, a.v);}
+
+ inline packd operator+(packd a, packd b) {return _mm_add_pd(a.v, b.v);}
+ inline packd operator-(packd a, packd b) {return _mm_sub_pd(a.v, b.v);}
+ inline packd operator*(packd a, packd b) {return _mm_mul_pd(a.v, b.v);}
+ inline packd operator/(packd a, packd b) {return _mm_div_pd(a.v, b.v);}
+ inline packd operator-(packd a)          {return _mm_xor_pd(a.v, _mm_set1_pd(-0.0));}
+
+ inline packd sqrt(packd a)         {return _mm_sqrt_pd(a.v);}
+ inline packd abs(packd a)          {return _mm_andnot_pd(_mm_set1_pd(-0.0), a.v);}
+ inline packd min(packd a, packd b) {return _mm_min_pd(a.v, b.v);}
+ inline packd max(packd a, packd b) {return _mm_max_pd(a.v, b.v);}
+
+ inline packd fma(packd a, packd b, packd c) {return a * b + c;}
+
+ inline packd cmplt(packd a, packd b) {return _mm_cmplt_pd(a.v, b.v);}
+ inline packd cmple(packd a, packd b) {return _mm_cmple_pd(a.v, b.v);}
+ inline packd cmpgt(packd a, packd b) {return _mm_cmpgt_pd(a.v, b.v);}
+ inline packd cmpge(packd a, packd b) {return _mm_cmpge_pd(a.v, b.v);}
+ inline packd cmpeq(packd a, packd b) {return _mm_cmpeq_pd(a.v, b.v);}
+
+ inline packd operator&(packd a, packd b) {return _mm_and_pd(a.v, b.v);}
+ inline packd operator|(packd a, packd b) {return _mm_or_pd(a.v, b.v);}
+ inline packd operator^(packd a, packd b) {return _mm_xor_pd(a.v, b.v);}
+ inline packd andnot(packd a, packd b)    {return _mm_andnot_pd(a.v, b.v);} // ~a & b
+
+ inline packd select(packd mask, packd a, packd b)
+ {
+    return _mm_or_pd(_mm_and_pd(mask.v, a.v), _mm_andnot_pd(mask.v, b.v));
+ }
+
+ /*
+  * SSE2 has no rounding instruction, so truncate through int and correct the result for
+  * negative non-integers.  Only valid for values within the range of int.
+  */
+ inline packd floor(packd a)
+ {
+    __m128d t = _mm_cvtepi32_pd(_mm_cvttpd_epi32(a.v));
+
+    return _mm_sub_pd(t, _mm_and_pd(_mm_cmpgt_pd(t, a.v), _mm_set1_pd(1.0)));
+ }
+
+ inline int movemask(packd mask) {return _mm_movemask_pd(mask.v);}
+
+#else
+
+ /*
+  * Scalar fallback.  A mask is represented by a double whose bits are all set (true) or
+  * clear (false), the same as for the vector instruction sets.
+  */
+ inline double toMask(bool b)
+ {
+    union {unsigned long long u; double d;} m;
+    m.u = b? ~0ULL: 0ULL;
+    return m.d;
+ }
+
+ inline bool isSet(double d)
+ {
+    union {unsigned long long u; double d;} m;
+    m.d = d;
+    return m.u != 0ULL;
+ }
+
+ inline packd broadcast(double d)        {return d;}
+ inline packd load(const double *p)      {return *p;}
+ inline packd loadu(const double *p)     {return *p;}
+ inline void  store(double *p, packd a)  {*p = a.v;}
+ inline void  storeu(double *p, packd a) {*p = a.v;}
+
+ inline packd operator+(packd a, packd b) {return a.v + b.v;}
+ inline packd operator-(packd a, packd b) {return a.v - b.v;}
+ inline packd operator*(packd a, packd b) {return a.v * b.v;}
+ inline packd operator/(packd a, packd b) {return a.v / b.v;}
+ inline packd operator-(packd a)          {return -a.v;}
+
+ inline packd sqrt(packd a)         {return std::sqrt(a.v);}
+ inline packd floor(packd a)        {return std::floor(a.v);}
+ inline packd abs(packd a)          {return std::fabs(a.v);}
+ inline packd min(packd a, packd b) {return (a.v < b.v)? a.v: b.v;}
+ inline packd max(packd a, packd b) {return (a.v > b.v)? a.v: b.v;}
+
+#ifdef __FMA__
+ inline packd fma(packd a, packd b, packd c) {return std::fma(a.v, b.v, c.v);}
+#else
+ inline packd fma(packd a, packd b, packd c) {return a * b + c;}
+#endif
+
+ inline packd cmplt(packd a, packd b) {return toMask(a.v <  b.v);}
+ inline packd cmple(packd a, packd b) {return toMask(a.v <= b.v);}
+ inline packd cmpgt(packd a, packd b) {return toMask(a.v >  b.v);}
+ inline packd cmpge(packd a, packd b) {return toMask(a.v >= b.v);}
+ inline packd cmpeq(packd a, packd b) {return toMask(a.v == b.v);}
+
+ inline packd operator&(packd a, packd b) {return toMask(isSet(a.v) && isSet(b.v));}
+ inline packd operator|(packd a, packd b) {return toMask(isSet(a.v) || isSet(b.v));}
+ inline packd operator^(packd a, packd b) {return toMask(isSet(a.v) != isSet(b.v));}
+ inline packd andnot(packd a, packd b)    {return toMask(!isSet(a.v) && isSet(b.v));}
+
+ inline packd select(packd mask, packd a, packd b) {return isSet(mask.v)? a.v: b.v;}
+ inline int   movemask(packd mask)                 {return isSet(mask.v)? 1: 0;}
+
+#endif
+
+ /*
+  * Return the number of elements of an n element array that can be processed in whole packs.
+  * Elements [packedCount(n), n) must be processed by scalar code.
+  */
+ inline std::size_t packedCount(std::size_t n) {return n - n % packd::width;}
+
+ /*
+  * Load/store the first min(n, packd::width) elements at aligned address p.
+  * Used for the last, partial, pack of an array.  Unused lanes are loaded as zero.
+  */
+ inline packd loadPartial(const double *p, std::size_t n)
+ {
+    if (n >= std::size_t(packd::width))
+      return load(p);
+
+    alignas(alignment) double tmp[packd::width] = {0.0};
+
+    for (std::size_t i = 0; i < n; ++i)
+      tmp[i] = p[i];
+
+    return load(tmp);
+ }
+
+ inline void storePartial(double *p, packd a, std::size_t n)
+ {
+    if (n >= std::size_t(packd::width))
+    {
+       store(p, a);
+       return;
+    }
+
+    alignas(alignment) double tmp[packd::width];
+
+    store(tmp, a);
+    for (std::size_t i = 0; i < n; ++i)
+      p[i] = tmp[i];
+ }
+
+} // end namespace TomsLibSimd
+
+#endif
+
+/*****************************************END*OF*FILE*********************************************/
@@ -0,0 +1,218 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "simd_math.h" - Polynomial approximations of sin, cos and atan2 over                            *
+*                 packs of doubles (see "simd.h").                                                *
+*                                                                                                 *
+*        Author - Tom McDonnell 2026                                                              *
+*                                                                                                 *
+\*************************************************************************************************/
+
+#ifndef TOMS_LIB_SIMD_MATH_H
+#define TOMS_LIB_SIMD_MATH_H
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "simd.h"
+
+// GLOBAL INLINE FUNCTION DEFINITIONS /////////////////////////////////////////////////////////////
+
+namespace TomsLibSimd
+{
+
+ // The coefficients are those of the Cephes maths library.  The full accuracy versions are
+ // the double precision Cephes functions (error within a few ulp), the fast versions are the
+ // single precision Cephes functions evaluated in double precision (error below 1e-7).
+
+ /*
+  * Evaluate polynomial c[0] x^(n-1) + c[1] x^(n-2) + ... + c[n-1] by Horner's rule.
+  */
+ template<int n>
+ inline packd polynomial(packd x, const double (&c)[n])
+ {
+    packd y = broadcast(c[0]);
+
+    for (int i = 1; i < n; ++i)
+      y = y * x + broadcast(c[i]);
+
+    return y;
+ }
+
+ /*
+  * Reduce angle |a| to z in [-pi/4, pi/4] and quadrant q in {0, 1, 2, 3},
+  * such that |a| = q * pi/2 + z.  'pio4' holds pi/4 split into 'n' parts, the first parts
+  * having enough trailing zero bits that y * pio4[i] is exact.
+  */
+ template<int n>
+ inline void reduceAngle(packd a, const double (&pio4)[n], packd &z, packd &q)
+ {
+    packd two = broadcast(2.0),
+          y   = floor(abs(a) * broadcast(1.27323954473516268615)); // 4/pi
+
+    // round y up to an even number (so z is within [-pi/4, pi/4])
+    y = y + (y - two * floor(y * broadcast(0.5)));
+
+    z = abs(a);
+    for (int i = 0; i < n; ++i)
+      z = z - y * broadcast(pio4[i]);
+
+    q = y * broadcast(0.5);
+    q = q - broadcast(4.0) * floor(q * broadcast(0.25));
+ }
+
+ /*
+  * Combine sin(z) and cos(z), z being the reduced angle for quadrant q of angle a,
+  * into s = sin(a) and c = cos(a).
+  */
+ inline void sincosFromQuadrant(packd a, packd q, packd sz, packd cz, packd &s, packd &c)
+ {
+    packd one   = broadcast(1.0),
+          two   = broadcast(2.0),
+          three = broadcast(3.0),
+          swap  = cmpeq(q, one) | cmpeq(q, three),
+          negS  = cmpge(q, two),
+          negC  = cmpeq(q, one) | cmpeq(q, two);
+
+    s = select(swap, cz, sz);
+    c = select(swap, sz, cz);
+    s = select(negS, -s, s);
+    c = select(negC, -c, c);
+    s = select(cmplt(a, broadcast(0.0)), -s, s);
+ }
+
+ /*
+  * s = sin(a), c = cos(a).  Full double precision for |a| < 1e9.
+  */
+ inline void sincos(packd a, packd &s, packd &c)
+ {
+    static const double pio4[3]   = { 7.85398125648498535156e-1,
+                                      3.77489470793079817668e-8,
+                                      2.69515142907905952645e-15},
+                        sinCof[6] = { 1.58962301576546568060e-10,
+                                     -2.50507477628578072866e-8,
+                                      2.75573136213857245213e-6,
+                                     -1.98412698295895385996e-4,
+                                      8.33333333332211858878e-3,
+                                     -1.66666666666666307295e-1},
+                        cosCof[6] = {-1.13585365213876817300e-11,
+                                      2.08757008419747316778e-9,
+                                     -2.75573141792967388112e-7,
+                                      2.48015872888517045348e-5,
+                                     -1.38888888888730564116e-3,
+                                      4.16666666666665929218e-2};
+    packd z, q;
+
+    reduceAngle(a, pio4, z, q);
+
+    packd zz = z * z,
+          sz = z + z * zz * polynomial(zz, sinCof),
+          cz = broadcast(1.0) - broadcast(0.5) * zz + zz * zz * polynomial(zz, cosCof);
+
+    sincosFromQuadrant(a, q, sz, cz, s, c);
+ }
+
+ /*
+  * s = sin(a), c = cos(a).  Absolute error below 1e-7 for |a| < 8192.
+  */
+ inline void sincosFast(packd a, packd &s, packd &c)
+ {
+    static const double pio4[1]   = { 7.85398163397448309616e-1},
+                        sinCof[3] = {-1.9515295891e-4,
+                                      8.3321608736e-3,
+                                     -1.6666654611e-1},
+                        cosCof[3] = { 2.443315711809948e-5,
+                                     -1.388731625493765e-3,
+                                      4.166664568298827e-2};
+    packd z, q;
+
+    reduceAngle(a, pio4, z, q);
+
+    packd zz = z * z,
+          sz = z + z * zz * polynomial(zz, sinCof),
+          cz = broadcast(1.0) - broadcast(0.5) * zz + zz * zz * polynomial(zz, cosCof);
+
+    sincosFromQuadrant(a, q, sz, cz, s, c);
+ }
+
+ /*
+  * Given t = atan(a) for a = min(|x|, |y|) / max(|x|, |y|), return atan2(y, x).
+  */
+ inline packd atan2FromOctant(packd y, packd x, packd t)
+ {
+    packd zero = broadcast(0.0);
+
+    t = select(cmpgt(abs(y), abs(x)), broadcast(1.57079632679489661923) - t, t);
+    t = select(cmplt(x, zero),        broadcast(3.14159265358979323846) - t, t);
+    t = select(cmplt(y, zero),        -t,                                    t);
+
+    return t;
+ }
+
+ /*
+  * Return min(|x|, |y|) / max(|x|, |y|), or 0 if both are 0.
+  */
+ inline packd octantRatio(packd y, packd x)
+ {
+    packd ax = abs(x),
+          ay = abs(y),
+          hi = max(ax, ay),
+          lo = min(ax, ay),
+          ok = cmpgt(hi, broadcast(0.0));
+
+    return select(ok, lo / select(ok, hi, broadcast(1.0)), broadcast(0.0));
+ }
+
+ /*
+  * Return atan2(y, x) in range [-pi, pi].  Full double precision.
+  */
+ inline packd atan2(packd y, packd x)
+ {
+    static const double p[5] = {-8.750608600031904122785e-1,
+                                -1.615753718733365076637e1,
+                                -7.500855792314704667340e1,
+                                -1.228866684490136173410e2,
+                                -6.485021904942025371773e1},
+                        q[6] = { 1.0,
+                                 2.485846490142306297962e1,
+                                 1.650270098316988542046e2,
+                                 4.328810604912902668951e2,
+                                 4.853903996359136964868e2,
+                                 1.945506571482613964425e2};
+
+    packd a     = octantRatio(y, x),
+          one   = broadcast(1.0),
+          big   = cmpgt(a, broadcast(0.66)),
+          t     = select(big, (a - one) / (a + one), a),
+          base  = select(big, broadcast(7.85398163397448309616e-1), broadcast(0.0)),
+          extra = select(big, broadcast(3.061616997868382943065e-17), broadcast(0.0)),
+          z     = t * t;
+
+    z = t * (z * polynomial(z, p) / polynomial(z, q)) + t;
+
+    return atan2FromOctant(y, x, base + (z + extra));
+ }
+
+ /*
+  * Return atan2(y, x) in range [-pi, pi].  Absolute error below 1e-7.
+  */
+ inline packd atan2Fast(packd y, packd x)
+ {
+    static const double p[4] = { 8.05374449538e-2,
+                                -1.38776856032e-1,
+                                 1.99777106478e-1,
+                                -3.33329491539e-1};
+
+    packd a    = octantRatio(y, x),
+          one  = broadcast(1.0),
+          big  = cmpgt(a, broadcast(0.4142135623730950)),
+          t    = select(big, (a - one) / (a + one), a),
+          base = select(big, broadcast(7.85398163397448309616e-1), broadcast(0.0)),
+          z    = t * t;
+
+    return atan2FromOctant(y, x, base + (t * z * polynomial(z, p) + t));
+ }
+
+} // end namespace TomsLibSimd
+
+#endif
+
+/*****************************************END*OF*FILE*********************************************/
@@ -0,0 +1,321 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "spatial_hash.cpp" -                                                                            *
+*                                                                                                 *
+*             Author - Tom McDonnell 2026                                                         *
+*                                                                                                 *
+\*************************************************************************************************/
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "spatial_hash.h"
+
+#include <math.h>
+
+#include <cassert>
+
+// MEMBER FUNCTION DEFINITIONS ////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ const spatialHash::handle spatialHash::none;
+
+ spatialHash::spatialHash(double cellSize1)
+ : cellSize(cellSize1), invCellSize(1.0 / cellSize1), count(0), cells(0), tableBits(6),
+   table(std::size_t(1) << tableBits)
+ {
+    assert(cellSize > 0);
+
+    for (std::size_t s = 0; s < table.size(); ++s)
+      table[s].count = 0;
+ }
+
+ spatialHash::handle spatialHash::insert(rec2vector p)
+ {
+    handle h;
+
+    if (freeHandles.empty())
+    {
+       h = handle(pos.size());
+       pos.push_back(p);
+       key.push_back(0);
+       next.push_back(none);
+       prev.push_back(none);
+    }
+    else
+    {
+       h = freeHandles.back();
+       freeHandles.pop_back();
+       pos[h] = p;
+    }
+
+    link(h, cellKey(p));
+    ++count;
+
+    return h;
+ }
+
+ void spatialHash::move(handle h, rec2vector p)
+ {
+    std::uint64_t k = cellKey(p);
+
+    pos[h] = p;
+
+    if (k != key[h])
+    {
+       unlink(h);
+       link(h, k);
+    }
+ }
+
+ void spatialHash::remove(handle h)
+ {
+    unlink(h);
+    freeHandles.push_back(h);
+    --count;
+ }
+
+ void spatialHash::clear(void)
+ {
+    for (std::size_t s = 0; s < table.size(); ++s)
+      table[s].count = 0;
+
+    pos.clear();
+    key.clear();
+    next.clear();
+    prev.clear();
+    freeHandles.clear();
+    count = cells = 0;
+ }
+
+ /*
+  * If the square around p covers more cells than there are table slots (or its size is not
+  * finite), the occupied cells are scanned instead of looked up one by one, which also keeps
+  * cell coordinates from wrapping round onto cells already visited.
+  */
+ void spatialHash::radiusQuery(rec2vector p, double radius, std::vector<handle> &out) const
+ {
+    double r2     = radius * radius,
+           spanX  = floor((p.x + radius) * invCellSize) - floor((p.x - radius) * invCellSize),
+           spanY  = floor((p.y + radius) * invCellSize) - floor((p.y - radius) * invCellSize),
+           covers = (spanX + 1) * (spanY + 1);
+
+    auto visit = [&](std::size_t s)
+    {
+       for (handle h = table[s].head; h != none; h = next[h])
+       {
+          rec2vector d = pos[h] - p;
+
+          if (d.x * d.x + d.y * d.y <= r2)
+            out.push_back(h);
+       }
+    };
+
+    if (!(covers <= double(table.size())))
+    {
+       for (std::size_t s = 0; s < table.size(); ++s)
+         if (table[s].count != 0)
+           visit(s);
+
+       return;
+    }
+
+    std::uint32_t x0 = cellCoord(p.x - radius), y0 = cellCoord(p.y - radius);
+    std::uint64_t nx = std::uint64_t(spanX) + 1, ny = std::uint64_t(spanY) + 1;
+
+    // cell coordinates wrap at 2^32, as in cellKey()
+    for (std::uint64_t i = 0; i < nx; ++i)
+      for (std::uint64_t j = 0; j < ny; ++j)
+      {
+         std::size_t s = find(pack(x0 + std::uint32_t(i), y0 + std::uint32_t(j)));
+
+         if (s != table.size())
+           visit(s);
+      }
+ }
+
+ /*
+  * Each occupied cell is paired with itself and with the neighbouring cells in the 'forward'
+  * half of the surrounding (2n + 1) x (2n + 1) block (n = ceil(radius / cellSize)), so that
+  * each pair of cells is considered once.
+  */
+ void spatialHash::neighbourPairs(double radius, std::vector<handlePair> &out) const
+ {
+    int    n  = int(ceil(radius * invCellSize));
+    double r2 = radius * radius;
+
+    out.clear();
+
+    for (std::size_t s = 0; s < table.size(); ++s)
+    {
+       if (table[s].count == 0) continue;
+
+       std::uint32_t cx = std::uint32_t(table[s].key >> 32),
+                     cy = std::uint32_t(table[s].key);
+
+       // pairs within the cell
+       for (handle a = table[s].head; a != none; a = next[a])
+         for (handle b = next[a]; b != none; b = next[b])
+         {
+            rec2vector d = pos[a] - pos[b];
+
+            if (d.x * d.x + d.y * d.y <= r2)
+              out.push_back(handlePair(a, b));
+         }
+
+       // pairs with forward neighbouring cells
+       for (int dy = 0; dy <= n; ++dy)
+         for (int dx = (dy == 0)? 1: -n; dx <= n; ++dx)
+         {
+            std::size_t t = find(pack(cx + std::uint32_t(dx), cy + std::uint32_t(dy)));
+
+            if (t == table.size()) continue;
+
+            for (handle a = table[s].head; a != none; a = next[a])
+              for (handle b = table[t].head; b != none; b = next[b])
+              {
+                 rec2vector d = pos[a] - pos[b];
+
+                 if (d.x * d.x + d.y * d.y <= r2)
+                   out.push_back(handlePair(a, b));
+              }
+         }
+    }
+ }
+
+ std::uint32_t spatialHash::cellCoord(double c) const
+ {
+    return std::uint32_t(std::int64_t(floor(c * invCellSize)));
+ }
+
+ std::uint64_t spatialHash::pack(std::uint32_t cx, std::uint32_t cy)
+ {
+    return std::uint64_t(cx) << 32 | cy;
+ }
+
+ std::uint64_t spatialHash::cellKey(rec2vector p) const
+ {
+    return pack(cellCoord(p.x), cellCoord(p.y));
+ }
+
+ /*
+  * Fibonacci hashing: the top bits of key * 2^64 / golden ratio.
+  */
+ std::size_t spatialHash::home(std::uint64_t k) const
+ {
+    return std::size_t((k * 0x9e3779b97f4a7c15ull) >> (64 - tableBits));
+ }
+
+ std::size_t spatialHash::find(std::uint64_t k) const
+ {
+    std::size_t mask = table.size() - 1;
+
+    for (std::size_t s = home(k); table[s].count != 0; s = (s + 1) & mask)
+      if (table[s].key == k)
+        return s;
+
+    return table.size();
+ }
+
+ /*
+  * Add point h to the front of the list of the cell with key k, adding the cell if need be.
+  */
+ void spatialHash::link(handle h, std::uint64_t k)
+ {
+    std::size_t mask = table.size() - 1, s;
+
+    for (s = home(k); table[s].count != 0 && table[s].key != k; s = (s + 1) & mask)
+      ;
+
+    if (table[s].count == 0)
+    {
+       table[s].key   = k;
+       table[s].head  = none;
+    }
+
+    key[h]  = k;
+    prev[h] = none;
+    next[h] = table[s].head;
+
+    if (table[s].head != none)
+      prev[table[s].head] = h;
+
+    table[s].head = h;
+    ++table[s].count;
+
+    // keep the table at most half full
+    if (table[s].count == 1 && ++cells > table.size() / 2)
+      grow();
+ }
+
+ /*
+  * Remove point h from the list of its cell, removing the cell if it becomes empty.
+  */
+ void spatialHash::unlink(handle h)
+ {
+    std::size_t s = find(key[h]);
+
+    assert(s < table.size());
+
+    if (prev[h] != none) next[prev[h]] = next[h];
+    else                 table[s].head = next[h];
+
+    if (next[h] != none) prev[next[h]] = prev[h];
+
+    if (--table[s].count == 0)
+      eraseSlot(s);
+ }
+
+ /*
+  * Empty slot s, shifting back later entries of its probe sequence so that no lookup
+  * passes over an empty slot before reaching its key.
+  */
+ void spatialHash::eraseSlot(std::size_t s)
+ {
+    std::size_t mask = table.size() - 1;
+
+    for (std::size_t j = (s + 1) & mask; table[j].count != 0; j = (j + 1) & mask)
+    {
+       std::size_t k = home(table[j].key);
+
+       // move entry j to s unless its home lies cyclically within (s, j]
+       if (((j - k) & mask) >= ((j - s) & mask))
+       {
+          table[s] = table[j];
+          s        = j;
+       }
+    }
+
+    table[s].count = 0;
+    --cells;
+ }
+
+ void spatialHash::grow(void)
+ {
+    std::vector<cell> old(std::size_t(1) << (tableBits + 1));
+
+    for (std::size_t s = 0; s < old.size(); ++s)
+      old[s].count = 0;
+
+    old.swap(table);
+    ++tableBits;
+
+    std::size_t mask = table.size() - 1;
+
+    for (std::size_t i = 0; i < old.size(); ++i)
+    {
+       if (old[i].count == 0) continue;
+
+       std::size_t s = home(old[i].key);
+
+       while (table[s].count != 0)
+         s = (s + 1) & mask;
+
+       table[s] = old[i];
+    }
+ }
+
+} // end namespace TomsLibGeometry
+
+/*****************************************END*OF*FILE*********************************************/
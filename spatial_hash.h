@@ -0,0 +1,106 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "spatial_hash.h" - Dynamic spatial hash of moving rec2vectors, with O(1) insertion,             *
+*                    movement and removal, radius queries, and enumeration of pairs               *
+*                    of neighbouring points.                                                      *
+*                                                                                                 *
+*           Author - Tom McDonnell 2026                                                           *
+*                                                                                                 *
+\*************************************************************************************************/
+
+#ifndef TOMS_LIB_SPATIAL_HASH_H
+#define TOMS_LIB_SPATIAL_HASH_H
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "geometry.h"
+#include "vector.h"
+
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+// GLOBAL TYPE DEFINITIONS ////////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ /*
+  * Points hashed by the square grid cell (of side 'cellSize') that contains them.
+  *
+  * Occupied cells are kept in a flat open addressing table (linear probing), each cell
+  * holding the head of a list of its points linked through arrays indexed by handle, so no
+  * memory is allocated per point.  Moving a point within its cell only updates its position.
+  *
+  * A handle stays valid, and refers to the same point, until the point is removed.
+  * Handles of removed points are reused.
+  */
+ class spatialHash
+ {
+  public:
+    typedef std::uint32_t             handle;
+    typedef std::pair<handle, handle> handlePair;
+
+    explicit spatialHash(double cellSize);
+
+    // h must be the handle of a point in the hash
+    handle insert(rec2vector p);
+    void   move(handle h, rec2vector p);
+    void   remove(handle h);
+    void   clear(void);
+
+    rec2vector  position(handle h) const {return pos[h];}
+    std::size_t size(void)         const {return count;}
+    double      getCellSize(void)  const {return cellSize;}
+
+    /*
+     * Append to 'out' the handles of the points within distance 'radius' of p.
+     */
+    void radiusQuery(rec2vector p, double radius, std::vector<handle> &out) const;
+
+    /*
+     * Set 'out' to the pairs of points within distance 'radius' of each other, each pair
+     * once.  Cheapest when radius <= cellSize.  'out' keeps its capacity between calls.
+     */
+    void neighbourPairs(double radius, std::vector<handlePair> &out) const;
+
+  private:
+    struct cell
+    {
+       std::uint64_t key;   // packed cell coordinates
+       handle        head;  // first point in the cell
+       std::uint32_t count; // number of points in the cell (0 = empty slot)
+    };
+
+    static const handle none = 0xffffffff;
+
+    std::uint32_t cellCoord(double c) const; // coordinates wrap at 2^32 cells
+    std::uint64_t cellKey(rec2vector p) const;
+
+    static std::uint64_t pack(std::uint32_t cx, std::uint32_t cy);
+    std::size_t   home(std::uint64_t key) const;
+    std::size_t   find(std::uint64_t key) const; // slot of key, or table.size() if not present
+
+    void link(handle h, std::uint64_t key);
+    void unlink(handle h);
+    void eraseSlot(std::size_t slot);
+    void grow(void);
+
+    double      cellSize, invCellSize;
+    std::size_t count, cells; // numbers of points and occupied cells
+    int         tableBits;
+
+    std::vector<cell>          table;
+    std::vector<rec2vector>    pos;         // indexed by handle
+    std::vector<std::uint64_t> key;         // cell key of each point
+    std::vector<handle>        next, prev;  // list of points in each cell
+    std::vector<handle>        freeHandles;
+ };
+
+} // end namespace TomsLibGeometry
+
+#endif
+
+/*****************************************END*OF*FILE*********************************************/
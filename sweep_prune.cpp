@@ -0,0 +1,202 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "sweep_prune.cpp" -                                                                             *
+*                                                                                                 *
+*            Author - Tom McDonnell 2026                                                          *
+*                                                                                                 *
+\*************************************************************************************************/
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "sweep_prune.h"
+
+#include <algorithm>
+
+#include <cassert>
+#include <cmath>
+
+// STATIC MEMBER CONSTANT DEFINITIONS /////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ const sweepAndPrune::handle sweepAndPrune::none;
+
+}
+
+// MEMBER FUNCTION DEFINITIONS ////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ sweepAndPrune::handle sweepAndPrune::insert(const rect &box)
+ {
+    handle h;
+
+    if (freeHandles.empty())
+    {
+       assert(boxes.size() < none);
+
+       h = handle(boxes.size());
+       boxes.push_back(box);
+       live.push_back(1);
+    }
+    else
+    {
+       h = freeHandles.back();
+       freeHandles.pop_back();
+       boxes[h] = box;
+       live[h]  = 1;
+    }
+
+    order.push_back({box.l, box.r, box.t, box.b, h}); // sorted into place by findPairs()
+    ++count;
+
+    return h;
+ }
+
+ void sweepAndPrune::remove(handle h)
+ {
+    assert(live[h]);
+
+    live[h] = 0;
+    removed.push_back(h);
+    --count;
+ }
+
+ void sweepAndPrune::clear(void)
+ {
+    count = 0;
+    boxes.clear();
+    live.clear();
+    order.clear();
+    freeHandles.clear();
+    removed.clear();
+ }
+
+ /*
+  * Copy the rectangles into the list (dropping removed ones), and sort it by insertion sort.
+  * If the sort has moved entries about eight places each on average, the list is far from
+  * sorted, and the rest is left to std::sort.
+  */
+ void sweepAndPrune::update(void)
+ {
+    std::size_t n = 0;
+
+    for (std::size_t i = 0; i < order.size(); ++i)
+    {
+       handle h = order[i].h;
+
+       if (!live[h]) continue;
+
+       const rect &box = boxes[h];
+
+       order[n++] = {box.l, box.r, box.t, box.b, h};
+    }
+
+    order.resize(n);
+    freeHandles.insert(freeHandles.end(), removed.begin(), removed.end());
+    removed.clear();
+
+    std::size_t budget = 8 * n + 64, moves = 0;
+
+    for (std::size_t i = 1; i < n; ++i)
+    {
+       if (order[i - 1].l <= order[i].l) continue;
+
+       entry       e = order[i];
+       std::size_t j = i;
+
+       do
+       {
+          order[j] = order[j - 1];
+          --j;
+       }
+       while (j > 0 && order[j - 1].l > e.l);
+
+       order[j] = e;
+       moves   += i - j;
+
+       if (moves > budget)
+       {
+          std::sort(order.begin(), order.end(),
+                    [](const entry &a, const entry &b) {return a.l < b.l;});
+          break;
+       }
+    }
+ }
+
+ void sweepAndPrune::findPairs(std::vector<handlePair> &out)
+ {
+    update();
+
+    out.clear();
+
+    const std::size_t n = order.size();
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+       const entry &a = order[i];
+
+       for (std::size_t j = i + 1; j < n && order[j].l <= a.r; ++j)
+       {
+          const entry &b = order[j];
+
+          if (b.b <= a.t && a.b <= b.t)
+            out.push_back((a.h < b.h)? handlePair(a.h, b.h): handlePair(b.h, a.h));
+       }
+    }
+ }
+
+} // end namespace TomsLibGeometry
+
+// GLOBAL FUNCTION DEFINITIONS ////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ rect sweptBounds(rec2vector c, rec2vector v, double radius)
+ {
+    rect box;
+
+    box.l = std::min(c.x, c.x + v.x) - radius;
+    box.r = std::max(c.x, c.x + v.x) + radius;
+    box.t = std::max(c.y, c.y + v.y) + radius;
+    box.b = std::min(c.y, c.y + v.y) - radius;
+
+    return box;
+ }
+
+ /*
+  * Relative to the first circle, the second has centre d + t w, and they touch where
+  * |d + t w|^2 = (r1 + r2)^2, ie. where a t^2 + 2 b t + c = 0.  The smaller root is found in
+  * the form c / (-b + sqrt(b^2 - a c)), which does not lose precision when a c is small.
+  */
+ bool sweptCircles(rec2vector c1, rec2vector v1, double r1,
+                   rec2vector c2, rec2vector v2, double r2, double &t)
+ {
+    rec2vector d = c2 - c1, w = v2 - v1;
+    double     sumR = r1 + r2,
+               a    = w.x * w.x + w.y * w.y,
+               b    = d.x * w.x + d.y * w.y,
+               c    = d.x * d.x + d.y * d.y - sumR * sumR;
+
+    if (c <= 0) {t = 0; return true;}  // overlapping at the start
+    if (b >= 0) return false;          // not closing
+
+    double disc = b * b - a * c;
+
+    if (disc < 0) return false;        // passing wide
+
+    double first = c / (-b + std::sqrt(disc));
+
+    if (first > 1) return false;
+
+    t = first;
+
+    return true;
+ }
+
+} // end namespace TomsLibGeometry
+
+/*****************************************END*OF*FILE*********************************************/
@@ -0,0 +1,110 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "sweep_prune.h" - Sweep and prune broadphase over moving rectangles, kept sorted                *
+*                   incrementally between frames, and swept tests between moving circles.         *
+*                                                                                                 *
+*          Author - Tom McDonnell 2026                                                            *
+*                                                                                                 *
+\*************************************************************************************************/
+
+#ifndef TOMS_LIB_SWEEP_PRUNE_H
+#define TOMS_LIB_SWEEP_PRUNE_H
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "geometry.h"
+#include "vector.h"
+
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+// GLOBAL TYPE DEFINITIONS ////////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ /*
+  * Broadphase finding the pairs of a set of moving rectangles (typically the bounds of
+  * bodies over a time step) that overlap.
+  *
+  * The rectangles are kept in a list sorted by their left edges.  Each call to findPairs()
+  * re-sorts the list by insertion sort, which is close to linear when the rectangles have
+  * moved little since the last call (falling back to a full sort if they have moved a lot),
+  * then sweeps it from left to right, testing each rectangle only against those that
+  * start before it ends.  Rectangles touching at an edge overlap.
+  *
+  * A handle stays valid, and refers to the same rectangle, until the rectangle is removed.
+  * Handles of removed rectangles are reused, but not before the next call to findPairs().
+  */
+ class sweepAndPrune
+ {
+  public:
+    typedef std::uint32_t             handle;
+    typedef std::pair<handle, handle> handlePair;
+
+    sweepAndPrune(void): count(0) {}
+
+    // h must be the handle of a rectangle in the set
+    handle insert(const rect &box);
+    void   move(handle h, const rect &box) {boxes[h] = box;}
+    void   remove(handle h);
+    void   clear(void);
+
+    const rect &bounds(handle h) const {return boxes[h];}
+    std::size_t size(void)       const {return count;}
+
+    /*
+     * Set 'out' to the pairs of rectangles that overlap, each pair once with the lower
+     * handle first.  'out' keeps its capacity between calls.
+     */
+    void findPairs(std::vector<handlePair> &out);
+
+  private:
+    struct entry
+    {
+       double l, r, t, b;
+       handle h;
+    };
+
+    static const handle none = 0xffffffff;
+
+    void update(void);
+
+    std::size_t count;
+
+    std::vector<rect>         boxes;       // indexed by handle
+    std::vector<std::uint8_t> live;        // indexed by handle
+    std::vector<entry>        order;       // sorted by l as of the last call to findPairs()
+    std::vector<handle>       freeHandles;
+    std::vector<handle>       removed;     // free after the next call to findPairs()
+ };
+
+}
+
+// GLOBAL FUNCTION DECLARATIONS ///////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ /*
+  * Return the bounds of a circle of radius 'radius' whose centre moves from c to c + v.
+  */
+ rect sweptBounds(rec2vector c, rec2vector v, double radius);
+
+ /*
+  * Circles of radii r1 and r2 move with their centres going from c1 to c1 + v1 and from
+  * c2 to c2 + v2 over a time step.  If they touch during the step, set t to the fraction
+  * of the step at which they first touch (0 if they overlap at the start) and return true.
+  * Otherwise return false.
+  */
+ bool sweptCircles(rec2vector c1, rec2vector v1, double r1,
+                   rec2vector c2, rec2vector v2, double r2, double &t);
+
+}
+
+#endif
+
+/*****************************************END*OF*FILE*********************************************/
@@ -0,0 +1,189 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "transform.cpp" -                                                                               *
+*                                                                                                 *
+*          Author - Tom McDonnell 2026                                                            *
+*                                                                                                 *
+\*************************************************************************************************/
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "transform.h"
+#include "simd.h"
+
+// LOCAL FUNCTION DEFINITIONS /////////////////////////////////////////////////////////////////////
+
+namespace TomsLibVector
+{
+ using TomsLibSimd::packd;
+ using TomsLibSimd::broadcast;
+ using TomsLibSimd::loadPartial;
+ using TomsLibSimd::storePartial;
+
+ /*
+  * out = M in, for the rows of 4x4 matrix m (w = 1 for each point of 'in').
+  * If 'projective', the bottom row of m is used to divide by w', else it is ignored.
+  */
+ template<bool projective>
+ static void transformKernel(const double (&m)[4][4], const rec3vectorBatch &in,
+                             rec3vectorBatch &out                              )
+ {
+    std::size_t n = in.size();
+    packd       a[4][4];
+
+    for (int r = 0; r < 4; ++r)
+      for (int c = 0; c < 4; ++c)
+        a[r][c] = broadcast(m[r][c]);
+
+    out.resize(n);
+
+    for (std::size_t i = 0; i < n; i += packd::width)
+    {
+       packd x  = loadPartial(in.x.data() + i, n - i),
+             y  = loadPartial(in.y.data() + i, n - i),
+             z  = loadPartial(in.z.data() + i, n - i),
+             x1 = a[0][0] * x + a[0][1] * y + a[0][2] * z + a[0][3],
+             y1 = a[1][0] * x + a[1][1] * y + a[1][2] * z + a[1][3],
+             z1 = a[2][0] * x + a[2][1] * y + a[2][2] * z + a[2][3];
+
+       if (projective)
+       {
+          packd w = broadcast(1.0) / (a[3][0] * x + a[3][1] * y + a[3][2] * z + a[3][3]);
+
+          x1 = x1 * w;
+          y1 = y1 * w;
+          z1 = z1 * w;
+       }
+
+       storePartial(out.x.data() + i, x1, n - i);
+       storePartial(out.y.data() + i, y1, n - i);
+       storePartial(out.z.data() + i, z1, n - i);
+    }
+ }
+
+} // end namespace TomsLibVector
+
+// MEMBER FUNCTION DEFINITIONS ////////////////////////////////////////////////////////////////////
+
+namespace TomsLibVector
+{
+
+ matrix3 matrix3::rotationX(double a)
+ {
+    double c = cos(a), s = sin(a);
+
+    return matrix3(1.0, 0.0, 0.0,
+                   0.0,   c,  -s,
+                   0.0,   s,   c);
+ }
+
+ matrix3 matrix3::rotationY(double a)
+ {
+    double c = cos(a), s = sin(a);
+
+    return matrix3(  c, 0.0,   s,
+                   0.0, 1.0, 0.0,
+                    -s, 0.0,   c);
+ }
+
+ matrix3 matrix3::rotationZ(double a)
+ {
+    double c = cos(a), s = sin(a);
+
+    return matrix3(  c,  -s, 0.0,
+                     s,   c, 0.0,
+                   0.0, 0.0, 1.0);
+ }
+
+ /*
+  * Rotation by angle a about 'axis' (which need not be of unit length).
+  */
+ matrix3 matrix3::rotation(rec3vector axis, double a)
+ {
+    return toMatrix3(quaternion::rotation(axis, a));
+ }
+
+ matrix3 matrix3::scaling(double sx, double sy, double sz)
+ {
+    return matrix3( sx, 0.0, 0.0,
+                   0.0,  sy, 0.0,
+                   0.0, 0.0,  sz);
+ }
+
+ quaternion quaternion::rotation(rec3vector axis, double a)
+ {
+    rec3vector u = axis * (sin(a / 2.0) / magnitude(axis));
+
+    return quaternion(cos(a / 2.0), u.x, u.y, u.z);
+ }
+
+} // end namespace TomsLibVector
+
+// GLOBAL FUNCTION DEFINITIONS ////////////////////////////////////////////////////////////////////
+
+namespace TomsLibVector
+{
+
+ /*
+  * Return the rotation matrix of unit quaternion q.
+  */
+ matrix3 toMatrix3(const quaternion &q)
+ {
+    double xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z,
+           xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z,
+           wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+    return matrix3(1.0 - 2.0 * (yy + zz),       2.0 * (xy - wz),       2.0 * (xz + wy),
+                         2.0 * (xy + wz), 1.0 - 2.0 * (xx + zz),       2.0 * (yz - wx),
+                         2.0 * (xz - wy),       2.0 * (yz + wx), 1.0 - 2.0 * (xx + yy));
+ }
+
+ matrix4 toMatrix4(const rigidTransform &a) {return matrix4(toMatrix3(a.q), a.t);}
+
+ matrix3 operator*(const matrix3 &a, const matrix3 &b)
+ {
+    matrix3 p;
+
+    for (int r = 0; r < 3; ++r)
+      for (int c = 0; c < 3; ++c)
+        p.m[r][c] = a.m[r][0] * b.m[0][c] + a.m[r][1] * b.m[1][c] + a.m[r][2] * b.m[2][c];
+
+    return p;
+ }
+
+ matrix4 operator*(const matrix4 &a, const matrix4 &b)
+ {
+    matrix4 p;
+
+    for (int r = 0; r < 4; ++r)
+      for (int c = 0; c < 4; ++c)
+        p.m[r][c] =   a.m[r][0] * b.m[0][c] + a.m[r][1] * b.m[1][c]
+                    + a.m[r][2] * b.m[2][c] + a.m[r][3] * b.m[3][c];
+
+    return p;
+ }
+
+ void transform(const matrix3 &a, const rec3vectorBatch &in, rec3vectorBatch &out)
+ {
+    transformKernel<false>(matrix4(a).m, in, out);
+ }
+
+ void transform(const matrix4 &a, const rec3vectorBatch &in, rec3vectorBatch &out)
+ {
+    if (a.affine()) transformKernel<false>(a.m, in, out);
+    else            transformKernel<true >(a.m, in, out);
+ }
+
+ void transform(const quaternion &q, const rec3vectorBatch &in, rec3vectorBatch &out)
+ {
+    transformKernel<false>(matrix4(toMatrix3(q)).m, in, out);
+ }
+
+ void transform(const rigidTransform &a, const rec3vectorBatch &in, rec3vectorBatch &out)
+ {
+    transformKernel<false>(toMatrix4(a).m, in, out);
+ }
+
+} // end namespace TomsLibVector
+
+/*****************************************END*OF*FILE*********************************************/
@@ -0,0 +1,278 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "transform.h" - 3x3 and 4x4 matrices, quaternions and rigid transforms                          *
+*                 for 3D vectors, with batch application to rec3vectorBatches.                    *
+*                                                                                                 *
+*        Author - Tom McDonnell 2026                                                              *
+*                                                                                                 *
+\*************************************************************************************************/
+
+#ifndef TOMS_LIB_TRANSFORM_H
+#define TOMS_LIB_TRANSFORM_H
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "vector.h"
+#include "vector_batch.h"
+
+#include <math.h>
+
+// GLOBAL TYPE DEFINITIONS ////////////////////////////////////////////////////////////////////////
+
+namespace TomsLibVector
+{
+
+ /*
+  * 3x3 matrix, m[row][column].  Applied to column vectors (v' = M v), so (A * B) v = A (B v).
+  */
+ class matrix3
+ {
+  public:
+    matrix3(void) {setIdentity();}
+
+    matrix3(double m00, double m01, double m02,
+            double m10, double m11, double m12,
+            double m20, double m21, double m22 )
+    {
+       m[0][0] = m00; m[0][1] = m01; m[0][2] = m02;
+       m[1][0] = m10; m[1][1] = m11; m[1][2] = m12;
+       m[2][0] = m20; m[2][1] = m21; m[2][2] = m22;
+    }
+
+    void setIdentity(void)
+    {
+       for (int r = 0; r < 3; ++r)
+         for (int c = 0; c < 3; ++c)
+           m[r][c] = (r == c)? 1.0: 0.0;
+    }
+
+    // rotations by angle a (radians, counterclockwise looking down the axis toward the origin)
+    static matrix3 rotationX(double a);
+    static matrix3 rotationY(double a);
+    static matrix3 rotationZ(double a);
+    static matrix3 rotation(rec3vector axis, double a);
+
+    static matrix3 scaling(double sx, double sy, double sz);
+
+    double m[3][3];
+ };
+
+ /*
+  * 4x4 matrix, m[row][column], for transforms of points in homogeneous coordinates.
+  * Applied to column vectors (v' = M v) with w = 1.  If the bottom row is not (0, 0, 0, 1),
+  * the result is divided by w'.
+  */
+ class matrix4
+ {
+  public:
+    matrix4(void) {setIdentity();}
+
+    explicit matrix4(const matrix3 &r, rec3vector t = rec3vector())
+    {
+       for (int i = 0; i < 3; ++i)
+       {
+          for (int j = 0; j < 3; ++j)
+            m[i][j] = r.m[i][j];
+          m[i][3] = 0.0;
+          m[3][i] = 0.0;
+       }
+       m[0][3] = t.x; m[1][3] = t.y; m[2][3] = t.z; m[3][3] = 1.0;
+    }
+
+    void setIdentity(void)
+    {
+       for (int r = 0; r < 4; ++r)
+         for (int c = 0; c < 4; ++c)
+           m[r][c] = (r == c)? 1.0: 0.0;
+    }
+
+    bool affine(void) const
+    {
+       return m[3][0] == 0.0 && m[3][1] == 0.0 && m[3][2] == 0.0 && m[3][3] == 1.0;
+    }
+
+    static matrix4 translation(rec3vector t) {return matrix4(matrix3(), t);}
+
+    double m[4][4];
+ };
+
+ /*
+  * Quaternion w + xi + yj + zk.  Unit quaternions represent rotations.
+  */
+ class quaternion
+ {
+  public:
+    quaternion(void)                                       : w( 1), x( 0), y( 0), z( 0) {}
+    quaternion(double w1, double x1, double y1, double z1) : w(w1), x(x1), y(y1), z(z1) {}
+
+    /*
+     * Rotation by angle a about 'axis' (which need not be of unit length).
+     */
+    static quaternion rotation(rec3vector axis, double a);
+
+    double w, x, y, z;
+ };
+
+ /*
+  * Rotation followed by translation: v' = q v q* + t.
+  */
+ class rigidTransform
+ {
+  public:
+    rigidTransform(void) {}
+    rigidTransform(const quaternion &q1, rec3vector t1): q(q1), t(t1) {}
+
+    quaternion q;
+    rec3vector t;
+ };
+
+} // end namespace TomsLibVector
+
+// GLOBAL FUNCTION DECLARATIONS ///////////////////////////////////////////////////////////////////
+
+namespace TomsLibVector
+{
+
+ matrix3 toMatrix3(const quaternion &);
+ matrix4 toMatrix4(const rigidTransform &);
+
+ matrix3 operator*(const matrix3 &, const matrix3 &);
+ matrix4 operator*(const matrix4 &, const matrix4 &);
+
+ // Batch transforms.  Element i of 'out' is the transform of element i of 'in', and 'out'
+ // (resized to match 'in' if necessary) may be 'in' itself.  Compose transforms with
+ // operator* first, so that each point is visited once.
+
+ void transform(const matrix3 &,        const rec3vectorBatch &in, rec3vectorBatch &out);
+ void transform(const matrix4 &,        const rec3vectorBatch &in, rec3vectorBatch &out);
+ void transform(const quaternion &,     const rec3vectorBatch &in, rec3vectorBatch &out);
+ void transform(const rigidTransform &, const rec3vectorBatch &in, rec3vectorBatch &out);
+
+} // end namespace TomsLibVector
+
+// GLOBAL INLINE FUNCTION DEFINITIONS /////////////////////////////////////////////////////////////
+
+namespace TomsLibVector
+{
+
+ // matrix functions
+
+ inline rec3vector operator*(const matrix3 &a, rec3vector v)
+ {
+    return rec3vector(a.m[0][0] * v.x + a.m[0][1] * v.y + a.m[0][2] * v.z,
+                      a.m[1][0] * v.x + a.m[1][1] * v.y + a.m[1][2] * v.z,
+                      a.m[2][0] * v.x + a.m[2][1] * v.y + a.m[2][2] * v.z);
+ }
+
+ inline rec3vector operator*(const matrix4 &a, rec3vector v)
+ {
+    rec3vector p(a.m[0][0] * v.x + a.m[0][1] * v.y + a.m[0][2] * v.z + a.m[0][3],
+                 a.m[1][0] * v.x + a.m[1][1] * v.y + a.m[1][2] * v.z + a.m[1][3],
+                 a.m[2][0] * v.x + a.m[2][1] * v.y + a.m[2][2] * v.z + a.m[2][3]);
+
+    if (a.affine())
+      return p;
+    else
+      return p / (a.m[3][0] * v.x + a.m[3][1] * v.y + a.m[3][2] * v.z + a.m[3][3]);
+ }
+
+ inline matrix3 transpose(const matrix3 &a)
+ {
+    return matrix3(a.m[0][0], a.m[1][0], a.m[2][0],
+                   a.m[0][1], a.m[1][1], a.m[2][1],
+                   a.m[0][2], a.m[1][2], a.m[2][2]);
+ }
+
+ inline double determinant(const matrix3 &a)
+ {
+    return   a.m[0][0] * (a.m[1][1] * a.m[2][2] - a.m[1][2] * a.m[2][1])
+           - a.m[0][1] * (a.m[1][0] * a.m[2][2] - a.m[1][2] * a.m[2][0])
+           + a.m[0][2] * (a.m[1][0] * a.m[2][1] - a.m[1][1] * a.m[2][0]);
+ }
+
+ // quaternion functions
+
+ inline quaternion operator*(const quaternion &a, const quaternion &b)
+ {
+    return quaternion(a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z,
+                      a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+                      a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+                      a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w);
+ }
+
+ inline quaternion conjugate(const quaternion &q) {return quaternion(q.w, -q.x, -q.y, -q.z);}
+
+ inline double magnitude(const quaternion &q)
+ {
+    return sqrt(q.w * q.w + q.x * q.x + q.y * q.y + q.z * q.z);
+ }
+
+ inline quaternion normalize(const quaternion &q)
+ {
+    double s = 1.0 / magnitude(q);
+
+    return quaternion(q.w * s, q.x * s, q.y * s, q.z * s);
+ }
+
+ /*
+  * Rotate v by unit quaternion q (q v q*).
+  */
+ inline rec3vector operator*(const quaternion &q, rec3vector v)
+ {
+    // v + 2 u x (u x v + w v), u being the vector part of q
+    rec3vector u(q.x, q.y, q.z),
+               t(u.y * v.z - u.z * v.y + q.w * v.x,
+                 u.z * v.x - u.x * v.z + q.w * v.y,
+                 u.x * v.y - u.y * v.x + q.w * v.z);
+
+    return v + 2.0 * rec3vector(u.y * t.z - u.z * t.y,
+                                u.z * t.x - u.x * t.z,
+                                u.x * t.y - u.y * t.x);
+ }
+
+ // rigidTransform functions
+
+ inline rec3vector operator*(const rigidTransform &a, rec3vector v) {return a.q * v + a.t;}
+
+ /*
+  * Return the transform equivalent to applying b then a.
+  */
+ inline rigidTransform operator*(const rigidTransform &a, const rigidTransform &b)
+ {
+    return rigidTransform(a.q * b.q, a.q * b.t + a.t);
+ }
+
+ inline rigidTransform inverse(const rigidTransform &a)
+ {
+    quaternion qi = conjugate(a.q);
+
+    return rigidTransform(qi, -(qi * a.t));
+ }
+
+ // pol3vector versions (converted through rec3vector)
+
+ inline pol3vector operator*(const matrix3 &a, const pol3vector &v)
+ {
+    return convToPol(a * convToRec(v));
+ }
+
+ inline pol3vector operator*(const matrix4 &a, const pol3vector &v)
+ {
+    return convToPol(a * convToRec(v));
+ }
+
+ inline pol3vector operator*(const quaternion &a, const pol3vector &v)
+ {
+    return convToPol(a * convToRec(v));
+ }
+
+ inline pol3vector operator*(const rigidTransform &a, const pol3vector &v)
+ {
+    return convToPol(a * convToRec(v));
+ }
+
+} // end namespace TomsLibVector
+
+#endif
+
+/*****************************************END*OF*FILE*********************************************/
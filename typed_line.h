@@ -0,0 +1,173 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "typed_line.h" - Line types with the representation fixed at compile time, so                   *
+*                  that functions of lines compile to straight-line code, and                     *
+*                  dispatch from the run-time representation of class line.                       *
+*                                                                                                 *
+*         Author - Tom McDonnell 2026                                                             *
+*                                                                                                 *
+\*************************************************************************************************/
+
+#ifndef TOMS_LIB_TYPED_LINE_H
+#define TOMS_LIB_TYPED_LINE_H
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "geometry.h"
+#include "vector.h"
+
+#include <assert.h>
+#include <math.h>
+
+// GLOBAL TYPE DEFINITIONS ////////////////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ /*
+  * Line with representation R (see class line).  basicLine<YeqMxPlusC> is y = mx + c,
+  * basicLine<XeqMyPlusC> is x = my + c.  Converts implicitly to line.
+  */
+ template<lineRep R>
+ class basicLine
+ {
+  public:
+    static const lineRep rep = R;
+
+    constexpr basicLine(double m1 = 0, double c1 = 0): m(m1), c(c1) {}
+
+    operator line(void) const {return line(m, c, R);}
+
+    double m, c;
+ };
+
+ typedef basicLine<YeqMxPlusC> lineYeqMxPlusC;
+ typedef basicLine<XeqMyPlusC> lineXeqMyPlusC;
+
+} // end namespace TomsLibGeometry
+
+// GLOBAL INLINE FUNCTION DEFINITIONS /////////////////////////////////////////////////////////////
+
+namespace TomsLibGeometry
+{
+
+ // dispatch from class line //
+
+ /*
+  * Return f(l) with l converted to the basicLine of its representation.
+  * f must return the same type for both representations (eg. a generic lambda).
+  */
+ template<class F>
+ inline auto dispatch(const line &l, F f) -> decltype(f(lineYeqMxPlusC()))
+ {
+    if (l.rep == YeqMxPlusC) return f(lineYeqMxPlusC(l.m, l.c));
+    else                     return f(lineXeqMyPlusC(l.m, l.c));
+ }
+
+ /*
+  * Return f(l1, l2) with l1 and l2 converted to the basicLines of their representations.
+  */
+ template<class F>
+ inline auto dispatch(const line &l1, const line &l2, F f)
+   -> decltype(f(lineYeqMxPlusC(), lineYeqMxPlusC()))
+ {
+    return dispatch(l1, [&](auto t1) {return dispatch(l2, [&](auto t2) {return f(t1, t2);});});
+ }
+
+ // parallel //
+
+ inline bool parallel(lineYeqMxPlusC l1, lineYeqMxPlusC l2) {return l1.m == l2.m;}
+ inline bool parallel(lineYeqMxPlusC l1, lineXeqMyPlusC l2) {return l1.m * l2.m == 1.0;}
+ inline bool parallel(lineXeqMyPlusC l1, lineYeqMxPlusC l2) {return l1.m * l2.m == 1.0;}
+ inline bool parallel(lineXeqMyPlusC l1, lineXeqMyPlusC l2) {return l1.m == l2.m;}
+
+ // intersection (lines must not be parallel) //
+
+ inline rec2vector intersection(lineYeqMxPlusC l1, lineYeqMxPlusC l2)
+ {
+    double x = (l2.c - l1.c) / (l1.m - l2.m);
+
+    return rec2vector(x, l1.m * x + l1.c);
+ }
+
+ inline rec2vector intersection(lineYeqMxPlusC l1, lineXeqMyPlusC l2)
+ {
+    double x = (l2.c + l2.m * l1.c) / (1 - l1.m * l2.m);
+
+    return rec2vector(x, l1.m * x + l1.c);
+ }
+
+ inline rec2vector intersection(lineXeqMyPlusC l1, lineYeqMxPlusC l2)
+ {
+    double x = (l1.c + l1.m * l2.c) / (1 - l1.m * l2.m);
+
+    return rec2vector(x, l2.m * x + l2.c);
+ }
+
+ inline rec2vector intersection(lineXeqMyPlusC l1, lineXeqMyPlusC l2)
+ {
+    double y = (l2.c - l1.c) / (l1.m - l2.m);
+
+    return rec2vector(l1.m * y + l1.c, y);
+ }
+
+ // position of point relative to line //
+
+ /*
+  * If p.y is higher on the y-axis than line l at x = p.x, return true.  Else false.
+  * For x = my + c, y at x = p.x is (p.x - c) / m.
+  */
+ inline bool operator>(rec2vector p, lineYeqMxPlusC l) {return p.y > l.m * p.x + l.c;}
+ inline bool operator>(rec2vector p, lineXeqMyPlusC l) {return p.y > (p.x - l.c) / l.m;}
+
+ /*
+  * If p.y is lower on the y-axis than line l at x = p.x, return true.  Else false.
+  */
+ inline bool operator<(rec2vector p, lineYeqMxPlusC l) {return p.y < l.m * p.x + l.c;}
+ inline bool operator<(rec2vector p, lineXeqMyPlusC l) {return p.y < (p.x - l.c) / l.m;}
+
+ template<lineRep R> inline bool operator<(basicLine<R> l, rec2vector p) {return p > l;}
+ template<lineRep R> inline bool operator>(basicLine<R> l, rec2vector p) {return p < l;}
+
+ // line/circle intersection //
+
+ /*
+  * Find the point(s) where line l intersects with the circle centred at p with radius r.
+  * Return false (leaving soln unchanged) if there are none.  If the line is a tangent,
+  * both solutions are the same point.
+  */
+ inline bool lineIntersectCirc(lineYeqMxPlusC l, rec2vector p, double r, rec2vector (&soln)[2])
+ {
+    double a   = -(1 + l.m * l.m),
+           b   = 2.0 * (p.x - l.m * l.c + l.m * p.y),
+           c   = r * r - p.x * p.x - l.c * l.c - p.y * p.y + 2.0 * l.c * p.y,
+           det = b * b - 4 * a * c;
+
+    if (det < 0) return false;
+
+    soln[0].x = (-b + sqrt(det)) / (2 * a); soln[0].y = l.m * soln[0].x + l.c;
+    soln[1].x = (-b - sqrt(det)) / (2 * a); soln[1].y = l.m * soln[1].x + l.c;
+
+    return true;
+ }
+
+ inline bool lineIntersectCirc(lineXeqMyPlusC l, rec2vector p, double r, rec2vector (&soln)[2])
+ {
+    double a   = -(1 + l.m * l.m),
+           b   = 2.0 * (p.y - l.m * l.c + l.m * p.x),
+           c   = r * r - p.y * p.y - l.c * l.c - p.x * p.x + 2.0 * l.c * p.x,
+           det = b * b - 4 * a * c;
+
+    if (det < 0) return false;
+
+    soln[0].y = (-b + sqrt(det)) / (2 * a); soln[0].x = l.m * soln[0].y + l.c;
+    soln[1].y = (-b - sqrt(det)) / (2 * a); soln[1].x = l.m * soln[1].y + l.c;
+
+    return true;
+ }
+
+} // end namespace TomsLibGeometry
+
+#endif
+
+/*****************************************END*OF*FILE*********************************************/
@@ -16,13 +16,16 @@
 
 #include <math.h>
 #include <iostream>
+#include <type_traits>
+
+#include <cstdint>
 
 // GLOBAL VARIABLES ///////////////////////////////////////////////////////////////////////////////
 
 namespace TomsLibVector
 {
 
- const double pi     = 3.141592654,
+ const double pi     = 3.14159265358979323846,
               twoPi  = 2.0 * pi,
               halfPi = pi / 2.0;
 
@@ -34,17 +37,47 @@ namespace TomsLibVector
 {
  using namespace TomsLibMisc;
 
+ /*
+  * Helper types for the rectangular vector templates.
+  * nonDeduced<T>::type is T, but prevents the scalar argument of the vector operators from
+  * taking part in template argument deduction (so that v * 2 compiles for a double vector).
+  * realOf<T>::type is the type returned by functions such as magnitude() that can not return
+  * an integer.
+  * truncatedScalar<T, S>::type exists only for an integer T and a floating point S, and
+  * removes the operators that would truncate such a scalar (see the deleted operators below).
+  */
+ template<class T> struct nonDeduced {typedef T type;};
+
+ template<class T, class S>
+ struct truncatedScalar: std::enable_if<std::is_integral<T>::value &&
+                                        std::is_floating_point<S>::value> {};
+
+ template<class T> struct realOf          {typedef T      type;};
+ template<>        struct realOf<int32_t> {typedef double type;};
+
  // 2D vector types //
 
- class rec2vector
+ /*
+  * Rectangular 2D vector with components of type T (float, double, or int32_t).
+  * Conversion between precisions must be explicit.
+  */
+ template<class T>
+ class basicRec2vector
  {
   public:
-    rec2vector(void)                 {x =  0; y =  0;}
-    rec2vector(double x1, double y1) {x = x1; y = y1;}
+    constexpr basicRec2vector(void)       : x( 0), y( 0) {}
+    constexpr basicRec2vector(T x1, T y1) : x(x1), y(y1) {}
+
+    template<class U>
+    constexpr explicit basicRec2vector(basicRec2vector<U> v): x(T(v.x)), y(T(v.y)) {}
 
-    double x, y;
+    T x, y;
  };
 
+ typedef basicRec2vector<double>  rec2vector;
+ typedef basicRec2vector<float>   rec2vectorf;
+ typedef basicRec2vector<int32_t> rec2vectori;
+
  class pol2vector
  {
   public:
@@ -79,10 +112,16 @@ namespace TomsLibVector
          error("Attempted to set pol2vector.angle to value outside range [-pi, pi].");
     }
 
-    double getR(void)     {return     r;}
-    double getAngle(void) {return angle;}
+    double getR(void)     const {return     r;}
+    double getAngle(void) const {return angle;}
 
-    void rotate(double a) {angle += a; if (a > pi) angle -= twoPi;}
+    void rotate(double a)
+    {
+       angle += a;
+
+       if (angle >  pi) angle -= twoPi;
+       if (angle < -pi) angle += twoPi;
+    }
 
   private:
     double r,     // r     must always be positive
@@ -91,15 +130,27 @@ namespace TomsLibVector
 
  // 3D vector types //
 
- class rec3vector
+ /*
+  * Rectangular 3D vector with components of type T (float, double, or int32_t).
+  * Conversion between precisions must be explicit.
+  */
+ template<class T>
+ class basicRec3vector
  {
   public:
-    rec3vector(void)                            {x =  0; y =  0; z =  0;}
-    rec3vector(double x1, double y1, double z1) {x = x1; y = y1; z = z1;}
+    constexpr basicRec3vector(void)             : x( 0), y( 0), z( 0) {}
+    constexpr basicRec3vector(T x1, T y1, T z1) : x(x1), y(y1), z(z1) {}
 
-    double x, y, z;
+    template<class U>
+    constexpr explicit basicRec3vector(basicRec3vector<U> v): x(T(v.x)), y(T(v.y)), z(T(v.z)) {}
+
+    T x, y, z;
  };
 
+ typedef basicRec3vector<double>  rec3vector;
+ typedef basicRec3vector<float>   rec3vectorf;
+ typedef basicRec3vector<int32_t> rec3vectori;
+
  class pol3vector
  {
   public:
@@ -130,9 +181,9 @@ namespace TomsLibVector
 
     pol3vector(double r, double aXZ, double aY) {setR(r); setAXZ(aXZ); setAY(aY);}
 
-    double getR(void)   {return   r;}
-    double getAXZ(void) {return aXZ;}
-    double getAY(void)  {return  aY;}
+    double getR(void)   const {return   r;}
+    double getAXZ(void) const {return aXZ;}
+    double getAY(void)  const {return  aY;}
 
   private:
     double r,   // r   must always be positive
@@ -152,8 +203,22 @@ namespace TomsLibVector
  // 2D VECTOR FUNCTIONS //
 
  // basic rec2vector functions
- inline double magnitude(rec2vector v) {return sqrt(pow(v.x, 2) + pow(v.y, 2));}
- inline double angle(rec2vector v)     {return atan2(v.y, v.x);}
+
+ template<class T>
+ inline typename realOf<T>::type magnitude(basicRec2vector<T> v)
+ {
+    typedef typename realOf<T>::type real;
+
+    return sqrt(pow(real(v.x), 2) + pow(real(v.y), 2));
+ }
+
+ template<class T>
+ inline typename realOf<T>::type angle(basicRec2vector<T> v)
+ {
+    typedef typename realOf<T>::type real;
+
+    return atan2(real(v.y), real(v.x));
+ }
 
  // basic pol2vector functions
  inline double xComponent(pol2vector v) {return v.getR() * cos(v.getAngle());}
@@ -165,38 +230,123 @@ namespace TomsLibVector
 
  // rec2vector functions
 
- inline double distance(rec2vector p1, rec2vector p2)
+ template<class T>
+ inline typename realOf<T>::type distance(basicRec2vector<T> p1, basicRec2vector<T> p2)
+ {
+    typedef typename realOf<T>::type real;
+
+    return sqrt(pow(real(p1.x - p2.x), 2.0) + pow(real(p1.y - p2.y), 2.0));
+ }
+
+ template<class T>
+ constexpr T vectDotProduct(basicRec2vector<T> v, basicRec2vector<T> v2)
+ {
+    return v.x * v2.x + v.y * v2.y;
+ }
+
+ // The scalar argument 'c' is of non-deduced type in the following, so the vector alone
+ // determines T and any arithmetic type may be passed as the scalar.
+
+ template<class T>
+ constexpr basicRec2vector<T> operator-(basicRec2vector<T> v)
  {
-    return sqrt(pow(p1.x - p2.x, 2.0) + pow(p1.y - p2.y, 2.0));
+    v.x = -v.x; v.y = -v.y; return v;
  }
 
- inline double vectDotProduct(rec2vector v, rec2vector v2) {return v.x * v2.x + v.y * v2.y;}
+ // Compound operators modify 'v' in place.  The binary operators are defined in terms of them.
+
+ template<class T>
+ constexpr basicRec2vector<T> &operator+=(basicRec2vector<T> &v, basicRec2vector<T> v2)
+ {
+    v.x += v2.x; v.y += v2.y; return v;
+ }
 
- inline rec2vector operator-(rec2vector v)                {v.x  = -v.x; v.y  = -v.y; return v;}
- inline rec2vector operator+(rec2vector v, rec2vector v2) {v.x += v2.x; v.y += v2.y; return v;}
- inline rec2vector operator-(rec2vector v, rec2vector v2) {v.x -= v2.x; v.y -= v2.y; return v;}
- inline rec2vector operator*(rec2vector v, double c)      {v.x *= c;    v.y *= c;    return v;}
- inline rec2vector operator*(double c, rec2vector v)      {return v * c;}
- inline rec2vector operator/(rec2vector v, double c)      {return v * (1.0 / c);}
- inline rec2vector operator/(double c, rec2vector v)      {return v / c;}
+ template<class T>
+ constexpr basicRec2vector<T> &operator-=(basicRec2vector<T> &v, basicRec2vector<T> v2)
+ {
+    v.x -= v2.x; v.y -= v2.y; return v;
+ }
 
- inline void operator+=(rec2vector &v, rec2vector v2) {v = v + v2;}
- inline void operator-=(rec2vector &v, rec2vector v2) {v = v - v2;}
- inline void operator*=(rec2vector &v, double      c) {v = v *  c;}
- inline void operator/=(rec2vector &v, double      c) {v = v /  c;}
+ template<class T>
+ constexpr basicRec2vector<T> &operator*=(basicRec2vector<T> &v, typename nonDeduced<T>::type c)
+ {
+    v.x *= c; v.y *= c; return v;
+ }
 
- inline bool operator==(rec2vector v1, rec2vector v2)
+ template<class T>
+ constexpr basicRec2vector<T> &operator/=(basicRec2vector<T> &v, typename nonDeduced<T>::type c)
  {
-    if (v1.x == v2.x && v1.y == v2.y) return true;
-    else                              return false;
+    // multiply by reciprocal for floating point types
+    if (std::is_integral<T>::value) {v.x /= c; v.y /= c; return v;}
+    else                            return v *= T(1) / c;
  }
 
- inline bool operator!=(rec2vector v1, rec2vector v2)
+ template<class T>
+ constexpr basicRec2vector<T> operator+(basicRec2vector<T> v, basicRec2vector<T> v2)
  {
-    if (!(v1 == v2)) return true;
-    else             return false;
+    return v += v2;
+ }
+
+ template<class T>
+ constexpr basicRec2vector<T> operator-(basicRec2vector<T> v, basicRec2vector<T> v2)
+ {
+    return v -= v2;
+ }
+
+ template<class T>
+ constexpr basicRec2vector<T> operator*(basicRec2vector<T> v, typename nonDeduced<T>::type c)
+ {
+    return v *= c;
+ }
+
+ template<class T>
+ constexpr basicRec2vector<T> operator*(typename nonDeduced<T>::type c, basicRec2vector<T> v)
+ {
+    return v *= c;
+ }
+
+ template<class T>
+ constexpr basicRec2vector<T> operator/(basicRec2vector<T> v, typename nonDeduced<T>::type c)
+ {
+    return v /= c;
  }
 
+ template<class T>
+ constexpr basicRec2vector<T> operator/(typename nonDeduced<T>::type c, basicRec2vector<T> v)
+ {
+    return v /= c;
+ }
+
+ // An integer vector would truncate a floating point scalar (v * 0.5 would be zero and
+ // v / 0.5 a division by zero), so such scalars are rejected at compile time.
+
+ template<class T, class S, class = typename truncatedScalar<T, S>::type>
+ basicRec2vector<T> &operator*=(basicRec2vector<T> &, S) = delete;
+
+ template<class T, class S, class = typename truncatedScalar<T, S>::type>
+ basicRec2vector<T> &operator/=(basicRec2vector<T> &, S) = delete;
+
+ template<class T, class S, class = typename truncatedScalar<T, S>::type>
+ basicRec2vector<T> operator*(basicRec2vector<T>, S) = delete;
+
+ template<class T, class S, class = typename truncatedScalar<T, S>::type>
+ basicRec2vector<T> operator*(S, basicRec2vector<T>) = delete;
+
+ template<class T, class S, class = typename truncatedScalar<T, S>::type>
+ basicRec2vector<T> operator/(basicRec2vector<T>, S) = delete;
+
+ template<class T, class S, class = typename truncatedScalar<T, S>::type>
+ basicRec2vector<T> operator/(S, basicRec2vector<T>) = delete;
+
+ template<class T>
+ constexpr bool operator==(basicRec2vector<T> v1, basicRec2vector<T> v2)
+ {
+    return v1.x == v2.x && v1.y == v2.y;
+ }
+
+ template<class T>
+ constexpr bool operator!=(basicRec2vector<T> v1, basicRec2vector<T> v2) {return !(v1 == v2);}
+
  // pol2vector functions
 
  inline double vectDotProduct(pol2vector v, pol2vector v2)
@@ -250,9 +400,30 @@ namespace TomsLibVector
  // 3D VECTOR FUNCTIONS //
 
  // basic rec3vector funtions
- inline double magnitude(rec3vector v) {return sqrt(pow(v.x, 2) + pow(v.y, 2) + pow(v.z, 2));}
- inline double angleXZ(rec3vector v)   {return atan2(v.z, v.x);}
- inline double angleY(rec3vector v)    {return atan2(sqrt(pow(v.x, 2) + pow(v.z, 2)), v.y);}
+
+ template<class T>
+ inline typename realOf<T>::type magnitude(basicRec3vector<T> v)
+ {
+    typedef typename realOf<T>::type real;
+
+    return sqrt(pow(real(v.x), 2) + pow(real(v.y), 2) + pow(real(v.z), 2));
+ }
+
+ template<class T>
+ inline typename realOf<T>::type angleXZ(basicRec3vector<T> v)
+ {
+    typedef typename realOf<T>::type real;
+
+    return atan2(real(v.z), real(v.x));
+ }
+
+ template<class T>
+ inline typename realOf<T>::type angleY(basicRec3vector<T> v)
+ {
+    typedef typename realOf<T>::type real;
+
+    return atan2(sqrt(pow(real(v.x), 2) + pow(real(v.z), 2)), real(v.y));
+ }
 
  // basic pol3vector functions
  inline double xComponent(pol3vector v) {return cos(v.getAXZ()) * (v.getR() * sin(v.getAY()));}
@@ -268,7 +439,8 @@ namespace TomsLibVector
 
  // rec3vector functions
 
- inline rec3vector operator-(rec3vector v)
+ template<class T>
+ constexpr basicRec3vector<T> operator-(basicRec3vector<T> v)
  {
     v.x = -v.x;
     v.y = -v.y;
@@ -277,7 +449,10 @@ namespace TomsLibVector
     return v;
  }
 
- inline rec3vector operator+(rec3vector v, rec3vector v2)
+ // Compound operators modify 'v' in place.  The binary operators are defined in terms of them.
+
+ template<class T>
+ constexpr basicRec3vector<T> &operator+=(basicRec3vector<T> &v, basicRec3vector<T> v2)
  {
     v.x += v2.x;
     v.y += v2.y;
@@ -286,7 +461,8 @@ namespace TomsLibVector
     return v;
  }
 
- inline rec3vector operator-(rec3vector v, rec3vector v2)
+ template<class T>
+ constexpr basicRec3vector<T> &operator-=(basicRec3vector<T> &v, basicRec3vector<T> v2)
  {
     v.x -= v2.x;
     v.y -= v2.y;
@@ -295,7 +471,8 @@ namespace TomsLibVector
     return v;
  }
 
- inline rec3vector operator*(rec3vector v, double c)
+ template<class T>
+ constexpr basicRec3vector<T> &operator*=(basicRec3vector<T> &v, typename nonDeduced<T>::type c)
  {
     v.x *= c;
     v.y *= c;
@@ -304,29 +481,72 @@ namespace TomsLibVector
     return v;
  }
 
- inline rec3vector operator*(double c, rec3vector v) {return v *        c ;}
- inline rec3vector operator/(rec3vector v, double c) {return v * (1.0 / c);}
+ template<class T>
+ constexpr basicRec3vector<T> &operator/=(basicRec3vector<T> &v, typename nonDeduced<T>::type c)
+ {
+    // multiply by reciprocal for floating point types
+    if (std::is_integral<T>::value) {v.x /= c; v.y /= c; v.z /= c; return v;}
+    else                            return v *= T(1) / c;
+ }
 
- inline void operator+=(rec3vector &v, rec3vector v2) {v = v + v2;}
- inline void operator-=(rec3vector &v, rec3vector v2) {v = v - v2;}
+ template<class T>
+ constexpr basicRec3vector<T> operator+(basicRec3vector<T> v, basicRec3vector<T> v2)
+ {
+    return v += v2;
+ }
 
- inline void operator*=(rec3vector &v, double c) {v = v * c;}
- inline void operator/=(rec3vector &v, double c) {v = v / c;}
+ template<class T>
+ constexpr basicRec3vector<T> operator-(basicRec3vector<T> v, basicRec3vector<T> v2)
+ {
+    return v -= v2;
+ }
 
- inline bool operator==(rec3vector v1, rec3vector v2)
+ template<class T>
+ constexpr basicRec3vector<T> operator*(basicRec3vector<T> v, typename nonDeduced<T>::type c)
  {
-    if (   v1.x == v2.x
-        && v1.y == v2.y
-        && v1.z == v2.z) return true;
-    else                 return false;
+    return v *= c;
  }
 
- inline bool operator!=(rec3vector v1, rec3vector v2)
+ template<class T>
+ constexpr basicRec3vector<T> operator*(typename nonDeduced<T>::type c, basicRec3vector<T> v)
  {
-    if (!(v1 == v2)) return true;
-    else             return false;
+    return v *= c;
+ }
+
+ template<class T>
+ constexpr basicRec3vector<T> operator/(basicRec3vector<T> v, typename nonDeduced<T>::type c)
+ {
+    return v /= c;
+ }
+
+ // floating point scalars are rejected for integer vectors, as for basicRec2vector
+
+ template<class T, class S, class = typename truncatedScalar<T, S>::type>
+ basicRec3vector<T> &operator*=(basicRec3vector<T> &, S) = delete;
+
+ template<class T, class S, class = typename truncatedScalar<T, S>::type>
+ basicRec3vector<T> &operator/=(basicRec3vector<T> &, S) = delete;
+
+ template<class T, class S, class = typename truncatedScalar<T, S>::type>
+ basicRec3vector<T> operator*(basicRec3vector<T>, S) = delete;
+
+ template<class T, class S, class = typename truncatedScalar<T, S>::type>
+ basicRec3vector<T> operator*(S, basicRec3vector<T>) = delete;
+
+ template<class T, class S, class = typename truncatedScalar<T, S>::type>
+ basicRec3vector<T> operator/(basicRec3vector<T>, S) = delete;
+
+ template<class T>
+ constexpr bool operator==(basicRec3vector<T> v1, basicRec3vector<T> v2)
+ {
+    return    v1.x == v2.x
+           && v1.y == v2.y
+           && v1.z == v2.z;
  }
 
+ template<class T>
+ constexpr bool operator!=(basicRec3vector<T> v1, basicRec3vector<T> v2) {return !(v1 == v2);}
+
  // pol3vector functions
 
  inline pol3vector operator-(pol3vector v)
@@ -379,25 +599,27 @@ namespace TomsLibVector
  }
 
  // functions to aid debugging
- inline std::ostream &operator<<(std::ostream &output, rec2vector const &v)
+ template<class T>
+ inline std::ostream &operator<<(std::ostream &output, basicRec2vector<T> const &v)
  {
     output << "(" << v.x << ", " << v.y << ")";
     return output;
  }
 
- inline std::ostream &operator<<(std::ostream &output, pol2vector &v)
+ inline std::ostream &operator<<(std::ostream &output, pol2vector const &v)
  {
     output << "(" << v.getR() << ", " << v.getAngle() * (180.0 / pi) << ")";
     return output;
  }
 
- inline std::ostream &operator<<(std::ostream &output, rec3vector const &v)
+ template<class T>
+ inline std::ostream &operator<<(std::ostream &output, basicRec3vector<T> const &v)
  {
     output << "(" << v.x << ", " << v.y << ", " << v.z << ")";
     return output;
  }
 
- inline std::ostream &operator<<(std::ostream &output, pol3vector &v)
+ inline std::ostream &operator<<(std::ostream &output, pol3vector const &v)
  {
     output << "(" << v.getR() << ", " << v.getAXZ() * (180.0 / pi) 
                               << ", " << v.getAY()  * (180.0 / pi) << ")";
@@ -0,0 +1,419 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "vector_batch.cpp" -                                                                            *
+*                                                                                                 *
+*             Author - Tom McDonnell 2026                                                         *
+*                                                                                                 *
+\*************************************************************************************************/
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "vector_batch.h"
+#include "simd.h"
+
+#include <cassert>
+
+// LOCAL FUNCTION DEFINITIONS /////////////////////////////////////////////////////////////////////
+
+namespace TomsLibVector
+{
+ using TomsLibSimd::packd;
+ using TomsLibSimd::broadcast;
+ using TomsLibSimd::load;
+ using TomsLibSimd::store;
+ using TomsLibSimd::packedCount;
+
+ /*
+  * Elementwise kernels over single component arrays.
+  * All arrays must be allocated through TomsLibSimd::alignedAllocator.
+  */
+
+ static void addArray(const double *a, const double *b, double *out, std::size_t n)
+ {
+    std::size_t i, p = packedCount(n);
+
+    for (i = 0; i < p; i += packd::width) store(out + i, load(a + i) + load(b + i));
+    for (     ; i < n; ++i              ) out[i] = a[i] + b[i];
+ }
+
+ static void subtractArray(const double *a, const double *b, double *out, std::size_t n)
+ {
+    std::size_t i, p = packedCount(n);
+
+    for (i = 0; i < p; i += packd::width) store(out + i, load(a + i) - load(b + i));
+    for (     ; i < n; ++i              ) out[i] = a[i] - b[i];
+ }
+
+ static void scaleArray(const double *a, double c, double *out, std::size_t n)
+ {
+    std::size_t i, p = packedCount(n);
+    packd       cc = broadcast(c);
+
+    for (i = 0; i < p; i += packd::width) store(out + i, load(a + i) * cc);
+    for (     ; i < n; ++i              ) out[i] = a[i] * c;
+ }
+
+ /*
+  * Kernels combining the D component arrays of each element.
+  * a[d] (and b[d]) point to the component arrays of a D dimensional batch.
+  */
+
+ template<int D>
+ static void dotArrays(const double *const *a, const double *const *b, double *out,
+                       std::size_t n                                              )
+ {
+    std::size_t i, p = packedCount(n);
+    int         d;
+
+    for (i = 0; i < p; i += packd::width)
+    {
+       packd sum = load(a[0] + i) * load(b[0] + i);
+       for (d = 1; d < D; ++d)
+         sum = sum + load(a[d] + i) * load(b[d] + i);
+       store(out + i, sum);
+    }
+
+    for (; i < n; ++i)
+    {
+       double sum = a[0][i] * b[0][i];
+       for (d = 1; d < D; ++d)
+         sum += a[d][i] * b[d][i];
+       out[i] = sum;
+    }
+ }
+
+ template<int D>
+ static void magnitudeArrays(const double *const *a, double *out, std::size_t n)
+ {
+    std::size_t i, p = packedCount(n);
+    int         d;
+
+    for (i = 0; i < p; i += packd::width)
+    {
+       packd sum = load(a[0] + i) * load(a[0] + i);
+       for (d = 1; d < D; ++d)
+         sum = sum + load(a[d] + i) * load(a[d] + i);
+       store(out + i, sqrt(sum));
+    }
+
+    for (; i < n; ++i)
+    {
+       double sum = a[0][i] * a[0][i];
+       for (d = 1; d < D; ++d)
+         sum += a[d][i] * a[d][i];
+       out[i] = ::sqrt(sum);
+    }
+ }
+
+ template<int D>
+ static void distanceArrays(const double *const *a, const double *const *b, double *out,
+                            std::size_t n                                              )
+ {
+    std::size_t i, p = packedCount(n);
+    int         d;
+
+    for (i = 0; i < p; i += packd::width)
+    {
+       packd diff = load(a[0] + i) - load(b[0] + i),
+             sum  = diff * diff;
+       for (d = 1; d < D; ++d)
+       {
+          diff = load(a[d] + i) - load(b[d] + i);
+          sum  = sum + diff * diff;
+       }
+       store(out + i, sqrt(sum));
+    }
+
+    for (; i < n; ++i)
+    {
+       double diff = a[0][i] - b[0][i],
+              sum  = diff * diff;
+       for (d = 1; d < D; ++d)
+       {
+          diff = a[d][i] - b[d][i];
+          sum += diff * diff;
+       }
+       out[i] = ::sqrt(sum);
+    }
+ }
+
+ /*
+  * Zero length vectors are left as zero length vectors.
+  */
+ template<int D>
+ static void normalizeArrays(const double *const *a, double *const *out, std::size_t n)
+ {
+    std::size_t i, p = packedCount(n);
+    int         d;
+    packd       zero = broadcast(0.0),
+                one  = broadcast(1.0);
+
+    for (i = 0; i < p; i += packd::width)
+    {
+       packd sum = load(a[0] + i) * load(a[0] + i);
+       for (d = 1; d < D; ++d)
+         sum = sum + load(a[d] + i) * load(a[d] + i);
+
+       packd inv = select(cmpgt(sum, zero), one / sqrt(sum), zero);
+       for (d = 0; d < D; ++d)
+         store(out[d] + i, load(a[d] + i) * inv);
+    }
+
+    for (; i < n; ++i)
+    {
+       double sum = a[0][i] * a[0][i];
+       for (d = 1; d < D; ++d)
+         sum += a[d][i] * a[d][i];
+
+       double inv = (sum > 0.0)? 1.0 / ::sqrt(sum): 0.0;
+       for (d = 0; d < D; ++d)
+         out[d][i] = a[d][i] * inv;
+    }
+ }
+
+} // end namespace TomsLibVector
+
+// MEMBER FUNCTION DEFINITIONS ////////////////////////////////////////////////////////////////////
+
+namespace TomsLibVector
+{
+
+ void rec2vectorBatch::assign(const std::vector<rec2vector> &v)
+ {
+    resize(v.size());
+
+    for (std::size_t i = 0; i < v.size(); ++i)
+    {
+       x[i] = v[i].x;
+       y[i] = v[i].y;
+    }
+ }
+
+ std::vector<rec2vector> rec2vectorBatch::toVector(void) const
+ {
+    std::vector<rec2vector> v(size());
+
+    for (std::size_t i = 0; i < v.size(); ++i)
+      v[i] = rec2vector(x[i], y[i]);
+
+    return v;
+ }
+
+ void pol2vectorBatch::assign(const std::vector<pol2vector> &v)
+ {
+    resize(v.size());
+
+    for (std::size_t i = 0; i < v.size(); ++i)
+    {
+       r[i]     = v[i].getR();
+       angle[i] = v[i].getAngle();
+    }
+ }
+
+ std::vector<pol2vector> pol2vectorBatch::toVector(void) const
+ {
+    std::vector<pol2vector> v(size());
+
+    for (std::size_t i = 0; i < v.size(); ++i)
+      v[i] = pol2vector(r[i], angle[i]);
+
+    return v;
+ }
+
+ void rec3vectorBatch::assign(const std::vector<rec3vector> &v)
+ {
+    resize(v.size());
+
+    for (std::size_t i = 0; i < v.size(); ++i)
+    {
+       x[i] = v[i].x;
+       y[i] = v[i].y;
+       z[i] = v[i].z;
+    }
+ }
+
+ std::vector<rec3vector> rec3vectorBatch::toVector(void) const
+ {
+    std::vector<rec3vector> v(size());
+
+    for (std::size_t i = 0; i < v.size(); ++i)
+      v[i] = rec3vector(x[i], y[i], z[i]);
+
+    return v;
+ }
+
+ void pol3vectorBatch::assign(const std::vector<pol3vector> &v)
+ {
+    resize(v.size());
+
+    for (std::size_t i = 0; i < v.size(); ++i)
+    {
+       r[i]   = v[i].getR();
+       aXZ[i] = v[i].getAXZ();
+       aY[i]  = v[i].getAY();
+    }
+ }
+
+ std::vector<pol3vector> pol3vectorBatch::toVector(void) const
+ {
+    std::vector<pol3vector> v(size());
+
+    for (std::size_t i = 0; i < v.size(); ++i)
+      v[i] = pol3vector(r[i], aXZ[i], aY[i]);
+
+    return v;
+ }
+
+} // end namespace TomsLibVector
+
+// GLOBAL FUNCTION DEFINITIONS ////////////////////////////////////////////////////////////////////
+
+namespace TomsLibVector
+{
+
+ // 2D batch functions //
+
+ void add(const rec2vectorBatch &a, const rec2vectorBatch &b, rec2vectorBatch &out)
+ {
+    assert(a.size() == b.size());
+
+    out.resize(a.size());
+    addArray(a.x.data(), b.x.data(), out.x.data(), a.size());
+    addArray(a.y.data(), b.y.data(), out.y.data(), a.size());
+ }
+
+ void subtract(const rec2vectorBatch &a, const rec2vectorBatch &b, rec2vectorBatch &out)
+ {
+    assert(a.size() == b.size());
+
+    out.resize(a.size());
+    subtractArray(a.x.data(), b.x.data(), out.x.data(), a.size());
+    subtractArray(a.y.data(), b.y.data(), out.y.data(), a.size());
+ }
+
+ void scale(const rec2vectorBatch &a, double c, rec2vectorBatch &out)
+ {
+    out.resize(a.size());
+    scaleArray(a.x.data(), c, out.x.data(), a.size());
+    scaleArray(a.y.data(), c, out.y.data(), a.size());
+ }
+
+ void normalize(const rec2vectorBatch &a, rec2vectorBatch &out)
+ {
+    out.resize(a.size());
+
+    const double *in[2]  = {a.x.data(),   a.y.data()  };
+    double       *res[2] = {out.x.data(), out.y.data()};
+
+    normalizeArrays<2>(in, res, a.size());
+ }
+
+ void vectDotProduct(const rec2vectorBatch &a, const rec2vectorBatch &b, doubleArray &out)
+ {
+    assert(a.size() == b.size());
+
+    out.resize(a.size());
+
+    const double *in1[2] = {a.x.data(), a.y.data()},
+                 *in2[2] = {b.x.data(), b.y.data()};
+
+    dotArrays<2>(in1, in2, out.data(), a.size());
+ }
+
+ void magnitude(const rec2vectorBatch &a, doubleArray &out)
+ {
+    out.resize(a.size());
+
+    const double *in[2] = {a.x.data(), a.y.data()};
+
+    magnitudeArrays<2>(in, out.data(), a.size());
+ }
+
+ void distance(const rec2vectorBatch &a, const rec2vectorBatch &b, doubleArray &out)
+ {
+    assert(a.size() == b.size());
+
+    out.resize(a.size());
+
+    const double *in1[2] = {a.x.data(), a.y.data()},
+                 *in2[2] = {b.x.data(), b.y.data()};
+
+    distanceArrays<2>(in1, in2, out.data(), a.size());
+ }
+
+ // 3D batch functions //
+
+ void add(const rec3vectorBatch &a, const rec3vectorBatch &b, rec3vectorBatch &out)
+ {
+    assert(a.size() == b.size());
+
+    out.resize(a.size());
+    addArray(a.x.data(), b.x.data(), out.x.data(), a.size());
+    addArray(a.y.data(), b.y.data(), out.y.data(), a.size());
+    addArray(a.z.data(), b.z.data(), out.z.data(), a.size());
+ }
+
+ void subtract(const rec3vectorBatch &a, const rec3vectorBatch &b, rec3vectorBatch &out)
+ {
+    assert(a.size() == b.size());
+
+    out.resize(a.size());
+    subtractArray(a.x.data(), b.x.data(), out.x.data(), a.size());
+    subtractArray(a.y.data(), b.y.data(), out.y.data(), a.size());
+    subtractArray(a.z.data(), b.z.data(), out.z.data(), a.size());
+ }
+
+ void scale(const rec3vectorBatch &a, double c, rec3vectorBatch &out)
+ {
+    out.resize(a.size());
+    scaleArray(a.x.data(), c, out.x.data(), a.size());
+    scaleArray(a.y.data(), c, out.y.data(), a.size());
+    scaleArray(a.z.data(), c, out.z.data(), a.size());
+ }
+
+ void normalize(const rec3vectorBatch &a, rec3vectorBatch &out)
+ {
+    out.resize(a.size());
+
+    const double *in[3]  = {a.x.data(),   a.y.data(),   a.z.data()  };
+    double       *res[3] = {out.x.data(), out.y.data(), out.z.data()};
+
+    normalizeArrays<3>(in, res, a.size());
+ }
+
+ void vectDotProduct(const rec3vectorBatch &a, const rec3vectorBatch &b, doubleArray &out)
+ {
+    assert(a.size() == b.size());
+
+    out.resize(a.size());
+
+    const double *in1[3] = {a.x.data(), a.y.data(), a.z.data()},
+                 *in2[3] = {b.x.data(), b.y.data(), b.z.data()};
+
+    dotArrays<3>(in1, in2, out.data(), a.size());
+ }
+
+ void magnitude(const rec3vectorBatch &a, doubleArray &out)
+ {
+    out.resize(a.size());
+
+    const double *in[3] = {a.x.data(), a.y.data(), a.z.data()};
+
+    magnitudeArrays<3>(in, out.data(), a.size());
+ }
+
+ void distance(const rec3vectorBatch &a, const rec3vectorBatch &b, doubleArray &out)
+ {
+    assert(a.size() == b.size());
+
+    out.resize(a.size());
+
+    const double *in1[3] = {a.x.data(), a.y.data(), a.z.data()},
+                 *in2[3] = {b.x.data(), b.y.data(), b.z.data()};
+
+    distanceArrays<3>(in1, in2, out.data(), a.size());
+ }
+
+} // end namespace TomsLibVector
+
+/*****************************************END*OF*FILE*********************************************/
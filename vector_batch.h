@@ -0,0 +1,262 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "vector_batch.h" - Structure-of-arrays containers for large numbers of                          *
+*                    vectors, and SIMD kernels over them.                                         *
+*                                                                                                 *
+*           Author - Tom McDonnell 2026                                                           *
+*                                                                                                 *
+\*************************************************************************************************/
+
+#ifndef TOMS_LIB_VECTOR_BATCH_H
+#define TOMS_LIB_VECTOR_BATCH_H
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "vector.h"
+#include "vector_expr.h"
+#include "simd.h"
+
+#include <vector>
+
+#include <cstddef>
+
+// GLOBAL TYPE DEFINITIONS ////////////////////////////////////////////////////////////////////////
+
+namespace TomsLibVector
+{
+ using TomsLibSimd::doubleArray;
+
+ /*
+  * Array of rec2vectors stored as separate contiguous aligned arrays of x and y components.
+  * Element i is (x[i], y[i]).  The component arrays must always be the same size.
+  * Arithmetic on whole batches builds expressions (see "vector_expr.h"), evaluated when
+  * assigned to a batch.
+  */
+ class rec2vectorBatch: public batchExpr<rec2vectorBatch>
+ {
+  public:
+    static const int  dims   = 2;
+    static const bool isLeaf = true;
+
+    rec2vectorBatch(void) {}
+    explicit rec2vectorBatch(std::size_t n): x(n), y(n) {}
+    rec2vectorBatch(const std::vector<rec2vector> &v) {assign(v);}
+
+    template<class E> rec2vectorBatch(const batchExpr<E> &e) {evaluate(e, *this);}
+
+    template<class E> rec2vectorBatch &operator=(const batchExpr<E> &e)
+    {
+       evaluate(e, *this); return *this;
+    }
+
+    template<class E> rec2vectorBatch &operator+=(const batchExpr<E> &e)
+    {
+       evaluate(*this + e, *this); return *this;
+    }
+
+    template<class E> rec2vectorBatch &operator-=(const batchExpr<E> &e)
+    {
+       evaluate(*this - e, *this); return *this;
+    }
+
+    rec2vectorBatch &operator*=(double c) {evaluate(*this * c, *this); return *this;}
+    rec2vectorBatch &operator/=(double c) {evaluate(*this / c, *this); return *this;}
+
+    std::size_t size(void)  const {return x.size();}
+    bool        empty(void) const {return x.empty();}
+
+    void resize(std::size_t n)  {x.resize(n);  y.resize(n); }
+    void reserve(std::size_t n) {x.reserve(n); y.reserve(n);}
+    void clear(void)            {x.clear();    y.clear();   }
+
+    void append(rec2vector v) {x.push_back(v.x); y.push_back(v.y);}
+
+    rec2vector get(std::size_t i) const         {return rec2vector(x[i], y[i]);}
+    void       set(std::size_t i, rec2vector v) {x[i] = v.x; y[i] = v.y;}
+
+    void                    assign(const std::vector<rec2vector> &);
+    std::vector<rec2vector> toVector(void) const;
+
+    // component access by index (0 = x, 1 = y), for expression evaluation
+    const double *component(int d) const {return (d == 0)? x.data(): y.data();}
+    double       *component(int d)       {return (d == 0)? x.data(): y.data();}
+
+    template<bool partial>
+    packd pack(int d, std::size_t i, std::size_t n) const
+    {
+       return partial? TomsLibSimd::loadPartial(component(d) + i, n):
+                       TomsLibSimd::load(component(d) + i);
+    }
+
+    doubleArray x, y;
+ };
+
+ /*
+  * Array of pol2vectors stored as separate contiguous aligned arrays of r and angle.
+  * Element i is (r[i], angle[i]).  The ranges of pol2vector are assumed but not enforced.
+  */
+ class pol2vectorBatch
+ {
+  public:
+    pol2vectorBatch(void) {}
+    explicit pol2vectorBatch(std::size_t n): r(n), angle(n) {}
+    pol2vectorBatch(const std::vector<pol2vector> &v) {assign(v);}
+
+    std::size_t size(void)  const {return r.size();}
+    bool        empty(void) const {return r.empty();}
+
+    void resize(std::size_t n)  {r.resize(n);  angle.resize(n); }
+    void reserve(std::size_t n) {r.reserve(n); angle.reserve(n);}
+    void clear(void)            {r.clear();    angle.clear();   }
+
+    void append(pol2vector v) {r.push_back(v.getR()); angle.push_back(v.getAngle());}
+
+    pol2vector get(std::size_t i) const         {return pol2vector(r[i], angle[i]);}
+    void       set(std::size_t i, pol2vector v) {r[i] = v.getR(); angle[i] = v.getAngle();}
+
+    void                    assign(const std::vector<pol2vector> &);
+    std::vector<pol2vector> toVector(void) const;
+
+    doubleArray r, angle;
+ };
+
+ /*
+  * Array of rec3vectors stored as separate contiguous aligned arrays of x, y and z components.
+  * Element i is (x[i], y[i], z[i]).  The component arrays must always be the same size.
+  * Arithmetic on whole batches builds expressions (see "vector_expr.h"), evaluated when
+  * assigned to a batch.
+  */
+ class rec3vectorBatch: public batchExpr<rec3vectorBatch>
+ {
+  public:
+    static const int  dims   = 3;
+    static const bool isLeaf = true;
+
+    rec3vectorBatch(void) {}
+    explicit rec3vectorBatch(std::size_t n): x(n), y(n), z(n) {}
+    rec3vectorBatch(const std::vector<rec3vector> &v) {assign(v);}
+
+    template<class E> rec3vectorBatch(const batchExpr<E> &e) {evaluate(e, *this);}
+
+    template<class E> rec3vectorBatch &operator=(const batchExpr<E> &e)
+    {
+       evaluate(e, *this); return *this;
+    }
+
+    template<class E> rec3vectorBatch &operator+=(const batchExpr<E> &e)
+    {
+       evaluate(*this + e, *this); return *this;
+    }
+
+    template<class E> rec3vectorBatch &operator-=(const batchExpr<E> &e)
+    {
+       evaluate(*this - e, *this); return *this;
+    }
+
+    rec3vectorBatch &operator*=(double c) {evaluate(*this * c, *this); return *this;}
+    rec3vectorBatch &operator/=(double c) {evaluate(*this / c, *this); return *this;}
+
+    std::size_t size(void)  const {return x.size();}
+    bool        empty(void) const {return x.empty();}
+
+    void resize(std::size_t n)  {x.resize(n);  y.resize(n);  z.resize(n); }
+    void reserve(std::size_t n) {x.reserve(n); y.reserve(n); z.reserve(n);}
+    void clear(void)            {x.clear();    y.clear();    z.clear();   }
+
+    void append(rec3vector v) {x.push_back(v.x); y.push_back(v.y); z.push_back(v.z);}
+
+    rec3vector get(std::size_t i) const         {return rec3vector(x[i], y[i], z[i]);}
+    void       set(std::size_t i, rec3vector v) {x[i] = v.x; y[i] = v.y; z[i] = v.z;}
+
+    void                    assign(const std::vector<rec3vector> &);
+    std::vector<rec3vector> toVector(void) const;
+
+    // component access by index (0 = x, 1 = y, 2 = z), for expression evaluation
+    const double *component(int d) const {return (d == 0)? x.data(): (d == 1)? y.data(): z.data();}
+    double       *component(int d)       {return (d == 0)? x.data(): (d == 1)? y.data(): z.data();}
+
+    template<bool partial>
+    packd pack(int d, std::size_t i, std::size_t n) const
+    {
+       return partial? TomsLibSimd::loadPartial(component(d) + i, n):
+                       TomsLibSimd::load(component(d) + i);
+    }
+
+    doubleArray x, y, z;
+ };
+
+ /*
+  * Array of pol3vectors stored as separate contiguous aligned arrays of r, aXZ and aY.
+  * Element i is (r[i], aXZ[i], aY[i]).  The ranges of pol3vector are assumed but not enforced.
+  */
+ class pol3vectorBatch
+ {
+  public:
+    pol3vectorBatch(void) {}
+    explicit pol3vectorBatch(std::size_t n): r(n), aXZ(n), aY(n) {}
+    pol3vectorBatch(const std::vector<pol3vector> &v) {assign(v);}
+
+    std::size_t size(void)  const {return r.size();}
+    bool        empty(void) const {return r.empty();}
+
+    void resize(std::size_t n)  {r.resize(n);  aXZ.resize(n);  aY.resize(n); }
+    void reserve(std::size_t n) {r.reserve(n); aXZ.reserve(n); aY.reserve(n);}
+    void clear(void)            {r.clear();    aXZ.clear();    aY.clear();   }
+
+    void append(pol3vector v)
+    {
+       r.push_back(v.getR()); aXZ.push_back(v.getAXZ()); aY.push_back(v.getAY());
+    }
+
+    pol3vector get(std::size_t i) const {return pol3vector(r[i], aXZ[i], aY[i]);}
+
+    void set(std::size_t i, pol3vector v)
+    {
+       r[i] = v.getR(); aXZ[i] = v.getAXZ(); aY[i] = v.getAY();
+    }
+
+    void                    assign(const std::vector<pol3vector> &);
+    std::vector<pol3vector> toVector(void) const;
+
+    doubleArray r, aXZ, aY;
+ };
+
+} // end namespace TomsLibVector
+
+// GLOBAL FUNCTION DECLARATIONS ///////////////////////////////////////////////////////////////////
+
+namespace TomsLibVector
+{
+
+ // Batch equivalents of the rec2vector/rec3vector functions in "vector.h".
+ // Each function applies the scalar function to element i of its input batch(es) and writes
+ // the result to element i of 'out', which is resized to match the input if necessary.
+ // Input batches must be the same size.  'out' may be one of the inputs.
+
+ // 2D batch functions
+
+ void add(const rec2vectorBatch &, const rec2vectorBatch &, rec2vectorBatch &out);
+ void subtract(const rec2vectorBatch &, const rec2vectorBatch &, rec2vectorBatch &out);
+ void scale(const rec2vectorBatch &, double c, rec2vectorBatch &out);
+ void normalize(const rec2vectorBatch &, rec2vectorBatch &out);
+
+ void vectDotProduct(const rec2vectorBatch &, const rec2vectorBatch &, doubleArray &out);
+ void magnitude(const rec2vectorBatch &, doubleArray &out);
+ void distance(const rec2vectorBatch &, const rec2vectorBatch &, doubleArray &out);
+
+ // 3D batch functions
+
+ void add(const rec3vectorBatch &, const rec3vectorBatch &, rec3vectorBatch &out);
+ void subtract(const rec3vectorBatch &, const rec3vectorBatch &, rec3vectorBatch &out);
+ void scale(const rec3vectorBatch &, double c, rec3vectorBatch &out);
+ void normalize(const rec3vectorBatch &, rec3vectorBatch &out);
+
+ void vectDotProduct(const rec3vectorBatch &, const rec3vectorBatch &, doubleArray &out);
+ void magnitude(const rec3vectorBatch &, doubleArray &out);
+ void distance(const rec3vectorBatch &, const rec3vectorBatch &, doubleArray &out);
+
+} // end namespace TomsLibVector
+
+#endif
+
+/*****************************************END*OF*FILE*********************************************/
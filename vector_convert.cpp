@@ -0,0 +1,149 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "vector_convert.cpp" -                                                                          *
+*                                                                                                 *
+*               Author - Tom McDonnell 2026                                                       *
+*                                                                                                 *
+\*************************************************************************************************/
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "vector_convert.h"
+#include "simd_math.h"
+
+// LOCAL FUNCTION DEFINITIONS /////////////////////////////////////////////////////////////////////
+
+namespace TomsLibVector
+{
+ using TomsLibSimd::packd;
+ using TomsLibSimd::loadPartial;
+ using TomsLibSimd::storePartial;
+
+ /*
+  * Select the approximation by template parameter so that the choice is made once per batch
+  * rather than once per pack.
+  */
+ template<bool fast>
+ static packd atan2Approx(packd y, packd x)
+ {
+    return fast? TomsLibSimd::atan2Fast(y, x): TomsLibSimd::atan2(y, x);
+ }
+
+ template<bool fast>
+ static void sincosApprox(packd a, packd &s, packd &c)
+ {
+    if (fast) TomsLibSimd::sincosFast(a, s, c);
+    else      TomsLibSimd::sincos(a, s, c);
+ }
+
+ template<bool fast>
+ static void recToPol(const rec2vectorBatch &in, pol2vectorBatch &out)
+ {
+    std::size_t n = in.size();
+
+    for (std::size_t i = 0; i < n; i += packd::width)
+    {
+       packd x = loadPartial(in.x.data() + i, n - i),
+             y = loadPartial(in.y.data() + i, n - i);
+
+       storePartial(out.r.data()     + i, sqrt(x * x + y * y),   n - i);
+       storePartial(out.angle.data() + i, atan2Approx<fast>(y, x), n - i);
+    }
+ }
+
+ template<bool fast>
+ static void polToRec(const pol2vectorBatch &in, rec2vectorBatch &out)
+ {
+    std::size_t n = in.size();
+
+    for (std::size_t i = 0; i < n; i += packd::width)
+    {
+       packd r = loadPartial(in.r.data() + i, n - i), s, c;
+
+       sincosApprox<fast>(loadPartial(in.angle.data() + i, n - i), s, c);
+
+       storePartial(out.x.data() + i, r * c, n - i);
+       storePartial(out.y.data() + i, r * s, n - i);
+    }
+ }
+
+ template<bool fast>
+ static void recToPol(const rec3vectorBatch &in, pol3vectorBatch &out)
+ {
+    std::size_t n = in.size();
+
+    for (std::size_t i = 0; i < n; i += packd::width)
+    {
+       packd x   = loadPartial(in.x.data() + i, n - i),
+             y   = loadPartial(in.y.data() + i, n - i),
+             z   = loadPartial(in.z.data() + i, n - i),
+             xz2 = x * x + z * z;
+
+       storePartial(out.r.data()   + i, sqrt(xz2 + y * y),              n - i);
+       storePartial(out.aXZ.data() + i, atan2Approx<fast>(z, x),         n - i);
+       storePartial(out.aY.data()  + i, atan2Approx<fast>(sqrt(xz2), y), n - i);
+    }
+ }
+
+ template<bool fast>
+ static void polToRec(const pol3vectorBatch &in, rec3vectorBatch &out)
+ {
+    std::size_t n = in.size();
+
+    for (std::size_t i = 0; i < n; i += packd::width)
+    {
+       packd r = loadPartial(in.r.data() + i, n - i), sXZ, cXZ, sY, cY;
+
+       sincosApprox<fast>(loadPartial(in.aXZ.data() + i, n - i), sXZ, cXZ);
+       sincosApprox<fast>(loadPartial(in.aY.data()  + i, n - i), sY,  cY );
+
+       packd rXZ = r * sY; // length of projection onto xz plane
+
+       storePartial(out.x.data() + i, cXZ * rXZ, n - i);
+       storePartial(out.y.data() + i, r   * cY,  n - i);
+       storePartial(out.z.data() + i, sXZ * rXZ, n - i);
+    }
+ }
+
+} // end namespace TomsLibVector
+
+// GLOBAL FUNCTION DEFINITIONS ////////////////////////////////////////////////////////////////////
+
+namespace TomsLibVector
+{
+
+ void convToPol(const rec2vectorBatch &in, pol2vectorBatch &out, convAccuracy acc)
+ {
+    out.resize(in.size());
+
+    if (acc == fastAccuracy) recToPol<true >(in, out);
+    else                     recToPol<false>(in, out);
+ }
+
+ void convToRec(const pol2vectorBatch &in, rec2vectorBatch &out, convAccuracy acc)
+ {
+    out.resize(in.size());
+
+    if (acc == fastAccuracy) polToRec<true >(in, out);
+    else                     polToRec<false>(in, out);
+ }
+
+ void convToPol(const rec3vectorBatch &in, pol3vectorBatch &out, convAccuracy acc)
+ {
+    out.resize(in.size());
+
+    if (acc == fastAccuracy) recToPol<true >(in, out);
+    else                     recToPol<false>(in, out);
+ }
+
+ void convToRec(const pol3vectorBatch &in, rec3vectorBatch &out, convAccuracy acc)
+ {
+    out.resize(in.size());
+
+    if (acc == fastAccuracy) polToRec<true >(in, out);
+    else                     polToRec<false>(in, out);
+ }
+
+} // end namespace TomsLibVector
+
+/*****************************************END*OF*FILE*********************************************/
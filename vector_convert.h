@@ -0,0 +1,50 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "vector_convert.h" - Batch conversion between rectangular and polar vectors.                    *
+*                                                                                                 *
+*             Author - Tom McDonnell 2026                                                         *
+*                                                                                                 *
+\*************************************************************************************************/
+
+#ifndef TOMS_LIB_VECTOR_CONVERT_H
+#define TOMS_LIB_VECTOR_CONVERT_H
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "vector_batch.h"
+
+// GLOBAL TYPE DEFINITIONS ////////////////////////////////////////////////////////////////////////
+
+namespace TomsLibVector
+{
+
+ /*
+  * Accuracy of the trigonometric approximations used by the batch conversion functions.
+  * fullAccuracy: error within a few ulp (comparable to the libm functions).
+  * fastAccuracy: absolute error below 1e-7, using shorter polynomials.
+  */
+ enum convAccuracy {fullAccuracy, fastAccuracy};
+
+}
+
+// GLOBAL FUNCTION DECLARATIONS ///////////////////////////////////////////////////////////////////
+
+namespace TomsLibVector
+{
+
+ // Batch equivalents of the convToPol()/convToRec() functions in "vector.h".
+ // Element i of 'out' is the conversion of element i of the input, and 'out' is resized to
+ // match the input if necessary.  Unlike the scalar versions, no range checks are made;
+ // the polar angles produced are always within [-pi, pi].
+
+ void convToPol(const rec2vectorBatch &, pol2vectorBatch &out, convAccuracy = fullAccuracy);
+ void convToRec(const pol2vectorBatch &, rec2vectorBatch &out, convAccuracy = fullAccuracy);
+
+ void convToPol(const rec3vectorBatch &, pol3vectorBatch &out, convAccuracy = fullAccuracy);
+ void convToRec(const pol3vectorBatch &, rec3vectorBatch &out, convAccuracy = fullAccuracy);
+
+} // end namespace TomsLibVector
+
+#endif
+
+/*****************************************END*OF*FILE*********************************************/
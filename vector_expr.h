@@ -0,0 +1,263 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "vector_expr.h" - Expression templates for arithmetic on vector batches.                        *
+*                   An expression such as a + b * s - c / t over batches is                       *
+*                   evaluated in a single pass when assigned to a batch,                          *
+*                   without temporary batches.                                                    *
+*                                                                                                 *
+*          Author - Tom McDonnell 2026                                                            *
+*                                                                                                 *
+\*************************************************************************************************/
+
+#ifndef TOMS_LIB_VECTOR_EXPR_H
+#define TOMS_LIB_VECTOR_EXPR_H
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "vector.h"
+#include "simd.h"
+
+#include <type_traits>
+
+#include <cassert>
+#include <cstddef>
+
+// GLOBAL TYPE DEFINITIONS ////////////////////////////////////////////////////////////////////////
+
+namespace TomsLibVector
+{
+ using TomsLibSimd::packd;
+
+ /*
+  * Base of all batch expressions, E being the derived type.  E must provide:
+  *
+  *   static const int  dims;   // number of components (2 or 3)
+  *   static const bool isLeaf; // true for the batch containers, which are held by reference
+  *
+  *   std::size_t size(void) const;
+  *
+  *   // Return component d of elements [i, i + packd::width).
+  *   // If 'partial', only the first n elements of the pack exist.
+  *   template<bool partial> packd pack(int d, std::size_t i, std::size_t n) const;
+  */
+ template<class E>
+ class batchExpr
+ {
+  public:
+    const E &self(void) const {return static_cast<const E &>(*this);}
+ };
+
+ /*
+  * Type used by an expression node to hold operand E.  Batches are held by reference,
+  * expression nodes (which are small, and usually temporaries) by value.
+  */
+ template<class E>
+ struct exprOperand
+ {
+    typedef typename std::conditional<E::isLeaf, const E &, const E>::type type;
+ };
+
+ /*
+  * l + r, l - r.
+  */
+ template<class L, class R, bool subtract>
+ class batchSum: public batchExpr<batchSum<L, R, subtract> >
+ {
+  public:
+    static const int  dims   = L::dims;
+    static const bool isLeaf = false;
+
+    batchSum(const L &l1, const R &r1): l(l1), r(r1) {assert(l.size() == r.size());}
+
+    std::size_t size(void) const {return l.size();}
+
+    template<bool partial>
+    packd pack(int d, std::size_t i, std::size_t n) const
+    {
+       packd a = l.template pack<partial>(d, i, n),
+             b = r.template pack<partial>(d, i, n);
+
+       return subtract? a - b: a + b;
+    }
+
+  private:
+    typename exprOperand<L>::type l;
+    typename exprOperand<R>::type r;
+ };
+
+ /*
+  * e * c.  Division by c is multiplication by 1 / c, as for the single vector operators.
+  */
+ template<class E>
+ class batchScaled: public batchExpr<batchScaled<E> >
+ {
+  public:
+    static const int  dims   = E::dims;
+    static const bool isLeaf = false;
+
+    batchScaled(const E &e1, double c1): e(e1), c(c1) {}
+
+    std::size_t size(void) const {return e.size();}
+
+    template<bool partial>
+    packd pack(int d, std::size_t i, std::size_t n) const
+    {
+       return e.template pack<partial>(d, i, n) * TomsLibSimd::broadcast(c);
+    }
+
+  private:
+    typename exprOperand<E>::type e;
+    double                        c;
+ };
+
+ /*
+  * s * e + v, for sign s = 1 or -1 and a single vector v added to every element.
+  */
+ template<class E>
+ class batchOffset: public batchExpr<batchOffset<E> >
+ {
+  public:
+    static const int  dims   = E::dims;
+    static const bool isLeaf = false;
+
+    batchOffset(const E &e1, double sign1, double vx, double vy, double vz = 0):
+      e(e1), sign(sign1) {v[0] = vx; v[1] = vy; v[2] = vz;}
+
+    std::size_t size(void) const {return e.size();}
+
+    template<bool partial>
+    packd pack(int d, std::size_t i, std::size_t n) const
+    {
+       using TomsLibSimd::broadcast;
+
+       return e.template pack<partial>(d, i, n) * broadcast(sign) + broadcast(v[d]);
+    }
+
+  private:
+    typename exprOperand<E>::type e;
+    double                        sign, v[3];
+ };
+
+} // end namespace TomsLibVector
+
+// GLOBAL INLINE FUNCTION DEFINITIONS /////////////////////////////////////////////////////////////
+
+namespace TomsLibVector
+{
+
+ /*
+  * Evaluate expression 'expr' into batch 'out' (resized to match) in a single pass.
+  * 'out' may be one of the batches in the expression.
+  */
+ template<class E, class B>
+ inline void evaluate(const batchExpr<E> &expr, B &out)
+ {
+    static_assert(int(E::dims) == int(B::dims), "Batch dimensions differ.");
+
+    const E    &e = expr.self();
+    std::size_t n = e.size(),
+                p = TomsLibSimd::packedCount(n),
+                i;
+    int         d;
+
+    out.resize(n);
+
+    for (i = 0; i < p; i += packd::width)
+      for (d = 0; d < E::dims; ++d)
+        TomsLibSimd::store(out.component(d) + i, e.template pack<false>(d, i, n - i));
+
+    if (i < n)
+      for (d = 0; d < E::dims; ++d)
+        TomsLibSimd::storePartial(out.component(d) + i, e.template pack<true>(d, i, n - i), n - i);
+ }
+
+ // operators building expressions //
+
+ template<class L, class R>
+ inline batchSum<L, R, false> operator+(const batchExpr<L> &l, const batchExpr<R> &r)
+ {
+    static_assert(int(L::dims) == int(R::dims), "Batch dimensions differ.");
+
+    return batchSum<L, R, false>(l.self(), r.self());
+ }
+
+ template<class L, class R>
+ inline batchSum<L, R, true> operator-(const batchExpr<L> &l, const batchExpr<R> &r)
+ {
+    static_assert(int(L::dims) == int(R::dims), "Batch dimensions differ.");
+
+    return batchSum<L, R, true>(l.self(), r.self());
+ }
+
+ template<class E>
+ inline batchScaled<E> operator*(const batchExpr<E> &e, double c)
+ {
+    return batchScaled<E>(e.self(), c);
+ }
+
+ template<class E>
+ inline batchScaled<E> operator*(double c, const batchExpr<E> &e)
+ {
+    return batchScaled<E>(e.self(), c);
+ }
+
+ template<class E>
+ inline batchScaled<E> operator/(const batchExpr<E> &e, double c)
+ {
+    return batchScaled<E>(e.self(), 1.0 / c);
+ }
+
+ template<class E>
+ inline batchScaled<E> operator-(const batchExpr<E> &e) {return batchScaled<E>(e.self(), -1.0);}
+
+ // adding a single vector to every element of a batch
+
+ template<class E>
+ inline batchOffset<E> operator+(const batchExpr<E> &e, rec2vector v)
+ {
+    static_assert(E::dims == 2, "Batch is not 2D.");
+
+    return batchOffset<E>(e.self(), 1.0, v.x, v.y);
+ }
+
+ template<class E>
+ inline batchOffset<E> operator+(rec2vector v, const batchExpr<E> &e) {return e + v;}
+
+ template<class E>
+ inline batchOffset<E> operator-(const batchExpr<E> &e, rec2vector v) {return e + -v;}
+
+ template<class E>
+ inline batchOffset<E> operator-(rec2vector v, const batchExpr<E> &e)
+ {
+    static_assert(E::dims == 2, "Batch is not 2D.");
+
+    return batchOffset<E>(e.self(), -1.0, v.x, v.y);
+ }
+
+ template<class E>
+ inline batchOffset<E> operator+(const batchExpr<E> &e, rec3vector v)
+ {
+    static_assert(E::dims == 3, "Batch is not 3D.");
+
+    return batchOffset<E>(e.self(), 1.0, v.x, v.y, v.z);
+ }
+
+ template<class E>
+ inline batchOffset<E> operator+(rec3vector v, const batchExpr<E> &e) {return e + v;}
+
+ template<class E>
+ inline batchOffset<E> operator-(const batchExpr<E> &e, rec3vector v) {return e + -v;}
+
+ template<class E>
+ inline batchOffset<E> operator-(rec3vector v, const batchExpr<E> &e)
+ {
+    static_assert(E::dims == 3, "Batch is not 3D.");
+
+    return batchOffset<E>(e.self(), -1.0, v.x, v.y, v.z);
+ }
+
+} // end namespace TomsLibVector
+
+#endif
+
+/*****************************************END*OF*FILE*********************************************/
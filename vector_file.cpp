@@ -0,0 +1,358 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "vector_file.cpp" -                                                                             *
+*                                                                                                 *
+*            Author - Tom McDonnell 2026                                                          *
+*                                                                                                 *
+\*************************************************************************************************/
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "vector_file.h"
+
+#include <fstream>
+#include <vector>
+
+#include <cstring>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+// LOCAL FUNCTION DEFINITIONS /////////////////////////////////////////////////////////////////////
+
+namespace TomsLibVector
+{
+
+ // The vector classes are viewed directly in mapped memory, so must be plain arrays of doubles.
+ static_assert(sizeof(rec2vector) == 2 * sizeof(double), "rec2vector is not 2 doubles.");
+ static_assert(sizeof(rec3vector) == 3 * sizeof(double), "rec3vector is not 3 doubles.");
+ static_assert(sizeof(pol2vector) == 2 * sizeof(double), "pol2vector is not 2 doubles.");
+ static_assert(sizeof(pol3vector) == 3 * sizeof(double), "pol3vector is not 3 doubles.");
+
+ static const char     vectorFileMagic[8] = {'T', 'L', 'V', 'E', 'C', 'T', 'O', 'R'};
+ static const uint32_t vectorFileVersion  = 1,
+                       vectorFileOrder    = 0x01020304;
+
+ static uint64_t roundUp(uint64_t n, uint64_t alignment)
+ {
+    return (n + alignment - 1) / alignment * alignment;
+ }
+
+ static int dimsOf(vectorKind k) {return (k == rec2kind || k == pol2kind)? 2: 3;}
+
+ static bool alignmentValid(uint64_t a) {return 8 <= a && a <= 4096 && (a & (a - 1)) == 0;}
+
+ /*
+  * Fill in the header of a file of n vectors of kind k.
+  */
+ static vectorFileHeader makeHeader(vectorKind k, vectorLayout l, unsigned alignment,
+                                    std::size_t n                                   )
+ {
+    vectorFileHeader h;
+
+    if (!alignmentValid(alignment))
+      throw vectorFileIOErr("Vector file alignment must be a power of 2 in [8, 4096].");
+
+    std::memset(&h, 0, sizeof(h));
+    std::memcpy(h.magic, vectorFileMagic, sizeof(h.magic));
+
+    h.byteOrder       = vectorFileOrder;
+    h.version         = vectorFileVersion;
+    h.kind            = k;
+    h.layout          = l;
+    h.alignment       = alignment;
+    h.count           = n;
+    h.dataOffset      = roundUp(sizeof(h), alignment);
+    h.componentStride = (l == soaLayout)? roundUp(n * sizeof(double), alignment): 0;
+
+    return h;
+ }
+
+ /*
+  * Output file that throws vectorFileIOErr on failure.
+  */
+ class vectorFileWriter
+ {
+  public:
+    vectorFileWriter(const std::string &path1): path(path1), out(path1.c_str(), std::ios::binary)
+    {
+       if (!out)
+         throw vectorFileIOErr("Could not open '" + path + "' for writing.");
+    }
+
+    void write(const void *p, std::size_t bytes)
+    {
+       if (!out.write((const char *)p, std::streamsize(bytes)))
+         throw vectorFileIOErr("Could not write to '" + path + "'.");
+    }
+
+    void pad(std::size_t bytes)
+    {
+       static const char zeros[4096] = {0};
+
+       for (; bytes > sizeof(zeros); bytes -= sizeof(zeros))
+         write(zeros, sizeof(zeros));
+       write(zeros, bytes);
+    }
+
+    void close(void)
+    {
+       out.close();
+       if (!out)
+         throw vectorFileIOErr("Could not close '" + path + "'.");
+    }
+
+  private:
+    std::string   path;
+    std::ofstream out;
+ };
+
+ /*
+  * Write the n vectors at v, each being 'dims' consecutive doubles.
+  */
+ static void writeArray(const std::string &path, vectorKind k, const double *v, std::size_t n,
+                        vectorLayout l, unsigned alignment                                     )
+ {
+    vectorFileHeader h    = makeHeader(k, l, alignment, n);
+    int              dims = dimsOf(k);
+    vectorFileWriter out(path);
+
+    out.write(&h, sizeof(h));
+    out.pad(std::size_t(h.dataOffset - sizeof(h)));
+
+    if (l == aosLayout)
+      out.write(v, n * dims * sizeof(double));
+    else
+    {
+       // gather each component through a buffer
+       const std::size_t   bufSize = 8192;
+       std::vector<double> buf(bufSize);
+
+       for (int d = 0; d < dims; ++d)
+       {
+          for (std::size_t i = 0; i < n; i += bufSize)
+          {
+             std::size_t m = (n - i < bufSize)? n - i: bufSize;
+
+             for (std::size_t j = 0; j < m; ++j)
+               buf[j] = v[(i + j) * dims + d];
+
+             out.write(buf.data(), m * sizeof(double));
+          }
+          out.pad(std::size_t(h.componentStride - n * sizeof(double)));
+       }
+    }
+
+    out.close();
+ }
+
+ /*
+  * Write the 'dims' component arrays c[0] .. c[dims - 1], each of n doubles.
+  */
+ static void writeComponents(const std::string &path, vectorKind k, const double *const *c,
+                             std::size_t n, unsigned alignment                             )
+ {
+    vectorFileHeader h = makeHeader(k, soaLayout, alignment, n);
+    vectorFileWriter out(path);
+
+    out.write(&h, sizeof(h));
+    out.pad(std::size_t(h.dataOffset - sizeof(h)));
+
+    for (int d = 0; d < dimsOf(k); ++d)
+    {
+       out.write(c[d], n * sizeof(double));
+       out.pad(std::size_t(h.componentStride - n * sizeof(double)));
+    }
+
+    out.close();
+ }
+
+} // end namespace TomsLibVector
+
+// MEMBER FUNCTION DEFINITIONS ////////////////////////////////////////////////////////////////////
+
+namespace TomsLibVector
+{
+
+ /*
+  * Map the file at 'path' and check its header.
+  */
+ mappedVectorFile::mappedVectorFile(const std::string &path): base(0), length(0)
+ {
+    int fd = open(path.c_str(), O_RDONLY);
+
+    if (fd < 0)
+      throw vectorFileIOErr("Could not open '" + path + "' for reading.");
+
+    struct stat st;
+
+    if (fstat(fd, &st) != 0)
+    {
+       ::close(fd);
+       throw vectorFileIOErr("Could not find size of '" + path + "'.");
+    }
+
+    length = std::size_t(st.st_size);
+
+    if (length < sizeof(vectorFileHeader))
+    {
+       ::close(fd);
+       throw vectorFileFormatErr("'" + path + "' is too short to be a vector file.");
+    }
+
+    void *p = mmap(0, length, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    ::close(fd); // mapping remains valid
+
+    if (p == MAP_FAILED)
+      throw vectorFileIOErr("Could not map '" + path + "'.");
+
+    base = (const char *)p;
+
+    // check header
+    const vectorFileHeader &h = header();
+    std::string             err;
+
+    if (std::memcmp(h.magic, vectorFileMagic, sizeof(h.magic)) != 0)
+      err = "is not a vector file";
+    else if (h.byteOrder != vectorFileOrder)
+      err = "was written on a machine of different byte order";
+    else if (h.version != vectorFileVersion)
+      err = "is of an unsupported version";
+    else if (h.kind < rec2kind || h.kind > pol3kind || h.layout > soaLayout)
+      err = "has an invalid header";
+    else if (!alignmentValid(h.alignment) || h.dataOffset % h.alignment != 0)
+      err = "has invalid alignment";
+    else if (h.dataOffset < sizeof(vectorFileHeader) || h.dataOffset > length)
+      err = "has an invalid data offset";
+    else
+    {
+       // sizes are compared by division, so that a crafted header cannot overflow them
+       uint64_t room = length - h.dataOffset, dims = dimsOf(vectorKind(h.kind));
+
+       if (h.layout == aosLayout)
+       {
+          if (h.count > room / (dims * sizeof(double)))
+            err = "is truncated";
+       }
+       else if (   h.count > h.componentStride / sizeof(double)
+                || h.componentStride % h.alignment != 0         )
+         err = "has an invalid component stride";
+       else if (h.componentStride > room / dims)
+         err = "is truncated";
+    }
+
+    if (!err.empty())
+    {
+       munmap((void *)base, length);
+       base = 0;
+       throw vectorFileFormatErr("'" + path + "' " + err + ".");
+    }
+ }
+
+ mappedVectorFile::~mappedVectorFile(void)
+ {
+    if (base != 0)
+      munmap((void *)base, length);
+ }
+
+ const void *mappedVectorFile::aosData(vectorKind k) const
+ {
+    if (getLayout() != aosLayout || getKind() != k)
+      throw vectorFileKindErr("Vector file layout or kind does not match view requested.");
+
+    return base + header().dataOffset;
+ }
+
+ const rec2vector *mappedVectorFile::rec2vectors(void) const
+ {
+    return (const rec2vector *)aosData(rec2kind);
+ }
+
+ const rec3vector *mappedVectorFile::rec3vectors(void) const
+ {
+    return (const rec3vector *)aosData(rec3kind);
+ }
+
+ const pol2vector *mappedVectorFile::pol2vectors(void) const
+ {
+    return (const pol2vector *)aosData(pol2kind);
+ }
+
+ const pol3vector *mappedVectorFile::pol3vectors(void) const
+ {
+    return (const pol3vector *)aosData(pol3kind);
+ }
+
+ const double *mappedVectorFile::component(int d) const
+ {
+    if (getLayout() != soaLayout || d < 0 || d >= dimsOf(getKind()))
+      throw vectorFileKindErr("Vector file layout or kind does not match view requested.");
+
+    return (const double *)(base + header().dataOffset + d * header().componentStride);
+ }
+
+} // end namespace TomsLibVector
+
+// GLOBAL FUNCTION DEFINITIONS ////////////////////////////////////////////////////////////////////
+
+namespace TomsLibVector
+{
+
+ void writeVectorFile(const std::string &path, const rec2vector *v, std::size_t n,
+                      vectorLayout l, unsigned alignment                          )
+ {
+    writeArray(path, rec2kind, (const double *)v, n, l, alignment);
+ }
+
+ void writeVectorFile(const std::string &path, const rec3vector *v, std::size_t n,
+                      vectorLayout l, unsigned alignment                          )
+ {
+    writeArray(path, rec3kind, (const double *)v, n, l, alignment);
+ }
+
+ void writeVectorFile(const std::string &path, const pol2vector *v, std::size_t n,
+                      vectorLayout l, unsigned alignment                          )
+ {
+    writeArray(path, pol2kind, (const double *)v, n, l, alignment);
+ }
+
+ void writeVectorFile(const std::string &path, const pol3vector *v, std::size_t n,
+                      vectorLayout l, unsigned alignment                          )
+ {
+    writeArray(path, pol3kind, (const double *)v, n, l, alignment);
+ }
+
+ void writeVectorFile(const std::string &path, const rec2vectorBatch &b, unsigned alignment)
+ {
+    const double *c[2] = {b.x.data(), b.y.data()};
+
+    writeComponents(path, rec2kind, c, b.size(), alignment);
+ }
+
+ void writeVectorFile(const std::string &path, const rec3vectorBatch &b, unsigned alignment)
+ {
+    const double *c[3] = {b.x.data(), b.y.data(), b.z.data()};
+
+    writeComponents(path, rec3kind, c, b.size(), alignment);
+ }
+
+ void writeVectorFile(const std::string &path, const pol2vectorBatch &b, unsigned alignment)
+ {
+    const double *c[2] = {b.r.data(), b.angle.data()};
+
+    writeComponents(path, pol2kind, c, b.size(), alignment);
+ }
+
+ void writeVectorFile(const std::string &path, const pol3vectorBatch &b, unsigned alignment)
+ {
+    const double *c[3] = {b.r.data(), b.aXZ.data(), b.aY.data()};
+
+    writeComponents(path, pol3kind, c, b.size(), alignment);
+ }
+
+} // end namespace TomsLibVector
+
+/*****************************************END*OF*FILE*********************************************/
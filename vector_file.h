@@ -0,0 +1,149 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "vector_file.h" - Binary file format for arrays of vectors, and memory-mapped                   *
+*                   read-only access to such files without copying or parsing.                    *
+*                                                                                                 *
+*          Author - Tom McDonnell 2026                                                            *
+*                                                                                                 *
+\*************************************************************************************************/
+
+#ifndef TOMS_LIB_VECTOR_FILE_H
+#define TOMS_LIB_VECTOR_FILE_H
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "vector.h"
+#include "vector_batch.h"
+
+#include <string>
+
+#include <cstddef>
+#include <cstdint>
+
+// GLOBAL TYPE DEFINITIONS ////////////////////////////////////////////////////////////////////////
+
+namespace TomsLibVector
+{
+
+ /*
+  * File layout (version 1, all values in the byte order of the writing machine):
+  *
+  *   header  (vectorFileHeader, 64 bytes)
+  *   padding (to 'alignment')
+  *   data
+  *
+  * For layout aosLayout, data is 'count' elements each of 2 or 3 doubles, in the same order
+  * as the members of the corresponding vector class.  For soaLayout, data is one array of
+  * 'count' doubles per component, each starting 'componentStride' bytes after the last
+  * (a multiple of 'alignment').
+  */
+ enum vectorKind   {rec2kind = 1, rec3kind = 2, pol2kind = 3, pol3kind = 4};
+ enum vectorLayout {aosLayout = 0, soaLayout = 1};
+
+ struct vectorFileHeader
+ {
+    char     magic[8];        // "TLVECTOR"
+    uint32_t byteOrder;       // 0x01020304 as written
+    uint32_t version;         // 1
+    uint32_t kind;            // vectorKind
+    uint32_t layout;          // vectorLayout
+    uint32_t alignment;       // of data and of each component array, power of 2 in [8, 4096]
+    uint32_t reserved0;
+    uint64_t count;           // number of vectors
+    uint64_t dataOffset;      // from start of file
+    uint64_t componentStride; // bytes between component arrays (soaLayout only)
+    uint64_t reserved1;
+ };
+
+ /*
+  * Exceptions thrown by the functions and classes below.
+  */
+ struct vectorFileErr
+ {
+    std::string msg;
+
+    vectorFileErr(const std::string &m): msg(m) {}
+ };
+
+ struct vectorFileIOErr: public vectorFileErr // file could not be opened, read, or written
+ {
+    vectorFileIOErr(const std::string &m): vectorFileErr(m) {}
+ };
+
+ struct vectorFileFormatErr: public vectorFileErr // file is not a valid vector file
+ {
+    vectorFileFormatErr(const std::string &m): vectorFileErr(m) {}
+ };
+
+ struct vectorFileKindErr: public vectorFileErr // view requested does not match file contents
+ {
+    vectorFileKindErr(const std::string &m): vectorFileErr(m) {}
+ };
+
+ /*
+  * Read-only memory mapping of a vector file.  Opening is independent of the file size: pages
+  * are read by the operating system as the returned pointers are dereferenced.  Pointers are
+  * valid until the mappedVectorFile is destroyed.
+  */
+ class mappedVectorFile
+ {
+  public:
+    explicit mappedVectorFile(const std::string &path);
+    ~mappedVectorFile(void);
+
+    vectorKind   getKind(void)   const {return vectorKind(header().kind);    }
+    vectorLayout getLayout(void) const {return vectorLayout(header().layout);}
+    std::size_t  size(void)      const {return std::size_t(header().count);  }
+
+    // aosLayout views (vectorFileKindErr thrown if the layout or kind differs)
+    const rec2vector *rec2vectors(void) const;
+    const rec3vector *rec3vectors(void) const;
+    const pol2vector *pol2vectors(void) const;
+    const pol3vector *pol3vectors(void) const;
+
+    // soaLayout view of component d (x, y, z or r, angle / r, aXZ, aY), aligned to alignment
+    const double *component(int d) const;
+
+  private:
+    mappedVectorFile(const mappedVectorFile &);            // not copyable
+    mappedVectorFile &operator=(const mappedVectorFile &); // not copyable
+
+    const vectorFileHeader &header(void) const {return *(const vectorFileHeader *)base;}
+
+    const void *aosData(vectorKind) const;
+
+    const char  *base;
+    std::size_t  length;
+ };
+
+} // end namespace TomsLibVector
+
+// GLOBAL FUNCTION DECLARATIONS ///////////////////////////////////////////////////////////////////
+
+namespace TomsLibVector
+{
+
+ // Write the n vectors at v to a new vector file at 'path' (vectorFileIOErr thrown on
+ // failure).  'alignment' must be a power of 2 in [8, 4096].
+
+ void writeVectorFile(const std::string &path, const rec2vector *v, std::size_t n,
+                      vectorLayout = aosLayout, unsigned alignment = 64           );
+ void writeVectorFile(const std::string &path, const rec3vector *v, std::size_t n,
+                      vectorLayout = aosLayout, unsigned alignment = 64           );
+ void writeVectorFile(const std::string &path, const pol2vector *v, std::size_t n,
+                      vectorLayout = aosLayout, unsigned alignment = 64           );
+ void writeVectorFile(const std::string &path, const pol3vector *v, std::size_t n,
+                      vectorLayout = aosLayout, unsigned alignment = 64           );
+
+ // Batches are written in soaLayout.
+
+ void writeVectorFile(const std::string &path, const rec2vectorBatch &, unsigned alignment = 64);
+ void writeVectorFile(const std::string &path, const rec3vectorBatch &, unsigned alignment = 64);
+ void writeVectorFile(const std::string &path, const pol2vectorBatch &, unsigned alignment = 64);
+ void writeVectorFile(const std::string &path, const pol3vectorBatch &, unsigned alignment = 64);
+
+} // end namespace TomsLibVector
+
+#endif
+
+/*****************************************END*OF*FILE*********************************************/
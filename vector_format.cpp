@@ -0,0 +1,280 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "vector_format.cpp" -                                                                           *
+*                                                                                                 *
+*              Author - Tom McDonnell 2026                                                        *
+*                                                                                                 *
+\*************************************************************************************************/
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "vector_format.h"
+
+#include <charconv>
+#include <cmath>
+
+// LOCAL FUNCTION DEFINITIONS /////////////////////////////////////////////////////////////////////
+
+namespace TomsLibVector
+{
+ using std::size_t;
+
+ const double degreesPerRadian = 180.0 / pi;
+ const double radiansPerDegree = pi / 180.0;
+
+ /*
+  * Angles read in degrees may exceed [-pi, pi] by rounding in the conversion to radians
+  * (eg. 180 * (pi / 180) > pi).  Angles within this tolerance of the range are clamped to it.
+  */
+ const double angleTolerance = 1e-12;
+
+ static bool isSpace(char c) {return c == ' ' || c == '\t' || c == '\n' || c == '\r';}
+
+ static const char *skipSpace(const char *p, const char *last)
+ {
+    while (p < last && isSpace(*p))
+      ++p;
+
+    return p;
+ }
+
+ /*
+  * Write "(c[0], c[1], ... c[n - 1])".
+  */
+ static char *formatComponents(char *first, char *last, const double *c, int n)
+ {
+    if (first == last) return 0;
+    *first++ = '(';
+
+    for (int i = 0; i < n; ++i)
+    {
+       if (i > 0)
+       {
+          if (last - first < 2) return 0;
+          *first++ = ',';
+          *first++ = ' ';
+       }
+
+       std::to_chars_result result = std::to_chars(first, last, c[i]);
+       if (result.ec != std::errc()) return 0;
+       first = result.ptr;
+    }
+
+    if (first == last) return 0;
+    *first++ = ')';
+
+    return first;
+ }
+
+ /*
+  * Read "(c[0], c[1], ... c[n - 1])" with optional white space around each token.
+  * A leading '+' on a number is accepted for symmetry with '-'.
+  */
+ static const char *parseComponents(const char *first, const char *last, double *c, int n)
+ {
+    first = skipSpace(first, last);
+    if (first == last || *first != '(') return 0;
+    ++first;
+
+    for (int i = 0; i < n; ++i)
+    {
+       first = skipSpace(first, last);
+
+       if (i > 0)
+       {
+          if (first == last || *first != ',') return 0;
+          first = skipSpace(first + 1, last);
+       }
+
+       if (first < last && *first == '+' && last - first > 1 && first[1] != '-')
+         ++first;
+
+       std::from_chars_result result = std::from_chars(first, last, c[i]);
+       if (result.ec != std::errc() || !std::isfinite(c[i])) return 0;
+       first = result.ptr;
+    }
+
+    first = skipSpace(first, last);
+    if (first == last || *first != ')') return 0;
+
+    return first + 1;
+ }
+
+ /*
+  * Convert an angle read in degrees to radians, returning false if it is out of range.
+  */
+ static bool toRadians(double degrees, double &radians)
+ {
+    radians = degrees * radiansPerDegree;
+
+    if (radians >  pi) {if (radians >  pi * (1 + angleTolerance)) return false; radians =  pi;}
+    if (radians < -pi) {if (radians < -pi * (1 + angleTolerance)) return false; radians = -pi;}
+
+    return true;
+ }
+
+ template<class V>
+ static size_t formatAll(char *first, char *last, const V *v, size_t n, char **end, char sep)
+ {
+    size_t i = 0;
+
+    for (; i < n; ++i)
+    {
+       char *p = formatVector(first, last, v[i]);
+       if (p == 0 || p == last) break;
+       *p++ = sep;
+       first = p;
+    }
+
+    *end = first;
+
+    return i;
+ }
+
+ template<class V>
+ static size_t parseAll(const char *first, const char *last, V *v, size_t n, const char **end)
+ {
+    size_t i = 0;
+
+    for (; i < n; ++i)
+    {
+       const char *p = first;
+
+       if (i > 0)
+       {
+          p = skipSpace(p, last);
+          if (p < last && *p == ',') ++p;
+       }
+
+       p = parseVector(p, last, v[i]);
+       if (p == 0) break;
+       first = p;
+    }
+
+    *end = first;
+
+    return i;
+ }
+
+} // end namespace TomsLibVector
+
+// GLOBAL FUNCTION DEFINITIONS ////////////////////////////////////////////////////////////////////
+
+namespace TomsLibVector
+{
+
+ char *formatVector(char *first, char *last, const rec2vector &v)
+ {
+    const double c[2] = {v.x, v.y};
+    return formatComponents(first, last, c, 2);
+ }
+
+ char *formatVector(char *first, char *last, const rec3vector &v)
+ {
+    const double c[3] = {v.x, v.y, v.z};
+    return formatComponents(first, last, c, 3);
+ }
+
+ char *formatVector(char *first, char *last, const pol2vector &v)
+ {
+    const double c[2] = {v.getR(), v.getAngle() * degreesPerRadian};
+    return formatComponents(first, last, c, 2);
+ }
+
+ char *formatVector(char *first, char *last, const pol3vector &v)
+ {
+    const double c[3] = {v.getR(), v.getAXZ() * degreesPerRadian, v.getAY() * degreesPerRadian};
+    return formatComponents(first, last, c, 3);
+ }
+
+ const char *parseVector(const char *first, const char *last, rec2vector &v)
+ {
+    double c[2];
+    const char *p = parseComponents(first, last, c, 2);
+    if (p != 0) v = rec2vector(c[0], c[1]);
+
+    return p;
+ }
+
+ const char *parseVector(const char *first, const char *last, rec3vector &v)
+ {
+    double c[3];
+    const char *p = parseComponents(first, last, c, 3);
+    if (p != 0) v = rec3vector(c[0], c[1], c[2]);
+
+    return p;
+ }
+
+ // The pol constructors call error() for out of range values, so validate before constructing.
+
+ const char *parseVector(const char *first, const char *last, pol2vector &v)
+ {
+    double c[2], a;
+    const char *p = parseComponents(first, last, c, 2);
+    if (p == 0 || c[0] < 0 || !toRadians(c[1], a)) return 0;
+    v = pol2vector(c[0], a);
+
+    return p;
+ }
+
+ const char *parseVector(const char *first, const char *last, pol3vector &v)
+ {
+    double c[3], aXZ, aY;
+    const char *p = parseComponents(first, last, c, 3);
+    if (p == 0 || c[0] < 0 || !toRadians(c[1], aXZ) || !toRadians(c[2], aY)) return 0;
+    v = pol3vector(c[0], aXZ, aY);
+
+    return p;
+ }
+
+ size_t formatVectors(char *first, char *last, const rec2vector *v, size_t n,
+                      char **end, char separator                             )
+ {
+    return formatAll(first, last, v, n, end, separator);
+ }
+
+ size_t formatVectors(char *first, char *last, const rec3vector *v, size_t n,
+                      char **end, char separator                             )
+ {
+    return formatAll(first, last, v, n, end, separator);
+ }
+
+ size_t formatVectors(char *first, char *last, const pol2vector *v, size_t n,
+                      char **end, char separator                             )
+ {
+    return formatAll(first, last, v, n, end, separator);
+ }
+
+ size_t formatVectors(char *first, char *last, const pol3vector *v, size_t n,
+                      char **end, char separator                             )
+ {
+    return formatAll(first, last, v, n, end, separator);
+ }
+
+ size_t parseVectors(const char *first, const char *last, rec2vector *v, size_t n,
+                     const char **end                                            )
+ {
+    return parseAll(first, last, v, n, end);
+ }
+
+ size_t parseVectors(const char *first, const char *last, rec3vector *v, size_t n,
+                     const char **end                                            )
+ {
+    return parseAll(first, last, v, n, end);
+ }
+
+ size_t parseVectors(const char *first, const char *last, pol2vector *v, size_t n,
+                     const char **end                                            )
+ {
+    return parseAll(first, last, v, n, end);
+ }
+
+ size_t parseVectors(const char *first, const char *last, pol3vector *v, size_t n,
+                     const char **end                                            )
+ {
+    return parseAll(first, last, v, n, end);
+ }
+
+} // end namespace TomsLibVector
+
+/*****************************************END*OF*FILE*********************************************/
@@ -0,0 +1,83 @@
+/*************************************************************************************************\
+*                                                                                                 *
+* "vector_format.h" - Allocation-free formatting and parsing of vectors in the                    *
+*                     notation of the operator<<()s of "vector.h", to and from                    *
+*                     caller supplied character buffers.                                          *
+*                                                                                                 *
+*            Author - Tom McDonnell 2026                                                          *
+*                                                                                                 *
+\*************************************************************************************************/
+
+#ifndef TOMS_LIB_VECTOR_FORMAT_H
+#define TOMS_LIB_VECTOR_FORMAT_H
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+
+#include "vector.h"
+
+#include <cstddef>
+
+// GLOBAL FUNCTION DECLARATIONS ///////////////////////////////////////////////////////////////////
+
+namespace TomsLibVector
+{
+
+ // Notation:
+ //   rec2vector "(x, y)"          pol2vector "(r, angle)"
+ //   rec3vector "(x, y, z)"       pol3vector "(r, aXZ, aY)"
+ // Polar angles are written in degrees, as by operator<<().
+ //
+ // Numbers are written in the shortest form that reads back as the same double, so
+ // rectangular vectors round trip exactly.  Polar angles round trip to within rounding of
+ // the conversion between radians and degrees.
+
+ // Write v to the buffer [first, last).  Return a pointer past the last character written,
+ // or 0 if the buffer is too small (the buffer contents are then unspecified).
+
+ char *formatVector(char *first, char *last, const rec2vector &v);
+ char *formatVector(char *first, char *last, const rec3vector &v);
+ char *formatVector(char *first, char *last, const pol2vector &v);
+ char *formatVector(char *first, char *last, const pol3vector &v);
+
+ // Read a vector from the buffer [first, last), skipping white space before it and within it.
+ // Return a pointer past the closing ')', or 0 if the text is not a valid vector (in which case
+ // v is not changed).  Polar vectors with negative r or angles outside [-180, 180] degrees
+ // are invalid.
+
+ const char *parseVector(const char *first, const char *last, rec2vector &v);
+ const char *parseVector(const char *first, const char *last, rec3vector &v);
+ const char *parseVector(const char *first, const char *last, pol2vector &v);
+ const char *parseVector(const char *first, const char *last, pol3vector &v);
+
+ // Bulk versions.  Format as many as possible of the n vectors at v into [first, last), each
+ // followed by 'separator', and return the number formatted.  '*end' is set past the last
+ // character written.  To format more vectors than fit, empty the buffer and call again
+ // starting from v + (number formatted).
+
+ std::size_t formatVectors(char *first, char *last, const rec2vector *v, std::size_t n,
+                           char **end, char separator = '\n'                          );
+ std::size_t formatVectors(char *first, char *last, const rec3vector *v, std::size_t n,
+                           char **end, char separator = '\n'                          );
+ std::size_t formatVectors(char *first, char *last, const pol2vector *v, std::size_t n,
+                           char **end, char separator = '\n'                          );
+ std::size_t formatVectors(char *first, char *last, const pol3vector *v, std::size_t n,
+                           char **end, char separator = '\n'                          );
+
+ // Parse up to n vectors from [first, last) into v, and return the number parsed.  Vectors may
+ // be separated by white space and/or commas.  '*end' is set past the last vector parsed.
+ // Parsing stops at the end of the buffer, after n vectors, or at text that is not a vector.
+
+ std::size_t parseVectors(const char *first, const char *last, rec2vector *v, std::size_t n,
+                          const char **end                                                 );
+ std::size_t parseVectors(const char *first, const char *last, rec3vector *v, std::size_t n,
+                          const char **end                                                 );
+ std::size_t parseVectors(const char *first, const char *last, pol2vector *v, std::size_t n,
+                          const char **end                                                 );
+ std::size_t parseVectors(const char *first, const char *last, pol3vector *v, std::size_t n,
+                          const char **end                                                 );
+
+} // end namespace TomsLibVector
+
+#endif
+
+/*****************************************END*OF*FILE*********************************************/